@@ -0,0 +1,66 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : cycle_counter.h
+  * @brief          : Header for cycle_counter.c file.
+  *                   This file contains the common defines of the application.
+  ******************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CYCLE_COUNTER_H__
+#define __CYCLE_COUNTER_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "fm33ht0xxa_fl.h"
+
+/* 计数器位宽掩码, 两次读数之差需与此掩码相与 */
+#define CYCLE_COUNTER_MASK      (0xFFFFFFFFUL)
+
+/* 溢出中断优先级 */
+#define CYCLE_COUNTER_IRQ_PRIORITY  (2U)
+
+extern FL_ErrorStatus CycleCounter_Init(void);
+extern void CycleCounter_IrqHandler(void);
+extern uint32_t CycleCounter_Read(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CYCLE_COUNTER_H__ */
+
+/************************ (C) COPYRIGHT FMSH *****END OF FILE****/
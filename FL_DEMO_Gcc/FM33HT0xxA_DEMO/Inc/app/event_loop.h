@@ -0,0 +1,93 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : event_loop.h
+  * @brief          : Header for event_loop.c file.
+  *                   This file contains the common defines of the application.
+  ******************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __EVENT_LOOP_H__
+#define __EVENT_LOOP_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "fm33ht0xxa_fl.h"
+
+/* 事件位, 由中断置位, EventLoop_Wait()取出并清除 */
+#define EVENT_TSI_SCAN          (1UL << 0U)     /* TSI扫描完成(MUX19) */
+#define EVENT_TICK              (1UL << 1U)     /* 时基节拍(MUX20) */
+#define EVENT_UART_RX           (1UL << 2U)     /* 调参串口接收(MUX6) */
+
+/* 心跳监督对象, 每个心跳周期内所有被监督对象均报到才清狗 */
+#define EVENT_ALIVE_LOOP        (1UL << 0U)     /* 主循环 */
+#define EVENT_ALIVE_TSI         (1UL << 1U)     /* TSI帧处理 */
+
+/* 心跳周期(ms), 需小于IWDT溢出时间 */
+#define EVENT_HEARTBEAT_MS      (500U)
+
+/* CPU占用率统计窗口(ms) */
+#define EVENT_DUTY_WINDOW_MS    (1000U)
+
+/* 事件循环统计, 调试器或APP_CMD_EVENT_STATS读取 */
+typedef struct
+{
+    uint32_t wakeCnt;           /* WFI唤醒次数, 含周期计数器溢出中断 */
+    uint32_t scanCnt;           /* 已处理的扫描帧数 */
+    uint32_t latencyUs;         /* 最近一帧扫描完成中断到TSI_WidgetUpdateCpltCallback的延迟(us) */
+    uint32_t latencyMaxUs;      /* 最大延迟(us) */
+    uint16_t busyPermille;      /* 上一统计窗口CPU非休眠占比(千分比) */
+    uint16_t missedBeatCnt;     /* 有对象未报到而未清狗的心跳周期数 */
+} EventLoop_StatsTypeDef;
+
+extern FL_ErrorStatus EventLoop_Init(uint32_t u32TickUs);
+extern uint32_t EventLoop_Wait(void);
+extern void EventLoop_Set(uint32_t u32Events);
+extern void EventLoop_TickIrq(uint32_t u32Ticks);
+extern void EventLoop_ScanIrq(void);
+extern void EventLoop_ScanProcessed(void);
+extern void EventLoop_Alive(uint32_t u32Alive);
+extern void EventLoop_Heartbeat(uint32_t u32Required);
+extern const EventLoop_StatsTypeDef *EventLoop_GetStats(void);
+extern void EventLoop_ClearLatency(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EVENT_LOOP_H__ */
+
+/************************ (C) COPYRIGHT FMSH *****END OF FILE****/
@@ -0,0 +1,90 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : model_slot.h
+  * @brief          : Header for model_slot.c file.
+  *                   This file contains the common defines of the application.
+  ******************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MODEL_SLOT_H__
+#define __MODEL_SLOT_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "fm33ht0xxa_fl.h"
+
+/* 模型槽位于Data Flash, 前6个扇区(12KB), 后2个扇区保留给其他参数 */
+#define MODEL_SLOT_ADDR         (0xA0000000UL)
+#define MODEL_SLOT_SIZE         (6U * FL_FLASH_DATA_SECTOR_SIZE_BYTE)
+
+/* 槽头标识 "TFMS" 及版本, 与Tools/pack_model_slot.py一致 */
+#define MODEL_SLOT_MAGIC        (0x534D4654UL)
+#define MODEL_SLOT_VERSION      (1U)
+
+/* 模型所需算子(BuiltinOperator)最大数量 */
+#define MODEL_SLOT_OP_MAX       (16U)
+
+/* 槽头, 模型flatbuffer紧随其后(16字节对齐)
+   crc: CRC-32(多项式0x04C11DB7, 初值0xFFFFFFFF, 不翻转不异或),
+        按小端32位字计算, 覆盖length字段起的槽头及按字补零的模型数据 */
+typedef struct
+{
+    uint32_t magic;             /* MODEL_SLOT_MAGIC */
+    uint16_t headerSize;        /* 槽头长度, 即模型数据偏移 */
+    uint16_t version;           /* MODEL_SLOT_VERSION */
+    uint32_t crc;               /* 见上 */
+    uint32_t length;            /* 模型长度(字节) */
+    uint32_t schemaVersion;     /* TFLite schema版本 */
+    uint32_t arenaSize;         /* 所需tensor arena(字节), 0表示未知 */
+    uint16_t opNum;             /* 所需算子数量 */
+    uint16_t reserved0;
+    uint16_t ops[MODEL_SLOT_OP_MAX];    /* 所需算子BuiltinOperator编码 */
+    uint32_t reserved1;
+} ModelSlot_HeaderTypeDef;
+
+extern const ModelSlot_HeaderTypeDef *ModelSlot_Validate(void);
+extern const uint8_t *ModelSlot_GetModel(const ModelSlot_HeaderTypeDef *header);
+extern FL_ErrorStatus ModelSlot_Erase(void);
+extern FL_ErrorStatus ModelSlot_Write(uint32_t offset, const uint32_t *data, uint32_t wordNum);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MODEL_SLOT_H__ */
+
+/************************ (C) COPYRIGHT FMSH *****END OF FILE****/
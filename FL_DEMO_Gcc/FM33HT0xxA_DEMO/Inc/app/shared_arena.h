@@ -0,0 +1,81 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : shared_arena.h
+  * @brief          : Header for shared_arena.c file.
+  *                   This file contains the common defines of the application.
+  ******************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SHARED_ARENA_H__
+#define __SHARED_ARENA_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "fm33ht0xxa_fl.h"
+
+/* 共享内存区大小(字节), 按最大使用者(TFLM tensor arena)配置 */
+#ifndef SHARED_ARENA_SIZE
+#define SHARED_ARENA_SIZE       (4096U)
+#endif
+
+/* 共享内存区对齐(字节), 与TFLM_ARENA_ALIGNMENT一致 */
+#define SHARED_ARENA_ALIGNMENT  (16U)
+
+/* 保护字数量及数值, 紧跟在使用者申请的长度之后 */
+#define SHARED_ARENA_GUARD_NUM  (4U)
+#define SHARED_ARENA_GUARD_WORD (0xA5C3E17BUL)
+
+/* 共享内存区使用阶段 */
+typedef enum
+{
+    SHARED_ARENA_PHASE_FREE = 0U,       /* 空闲 */
+    SHARED_ARENA_PHASE_TSI_INIT,        /* TSI初始化/校准扫描缓存 */
+    SHARED_ARENA_PHASE_TFLM,            /* TFLM tensor arena */
+} SharedArena_PhaseTypeDef;
+
+extern void *SharedArena_Acquire(SharedArena_PhaseTypeDef phase, uint32_t size);
+extern FL_ErrorStatus SharedArena_Release(SharedArena_PhaseTypeDef phase);
+extern FL_ErrorStatus SharedArena_Check(void);
+extern SharedArena_PhaseTypeDef SharedArena_GetPhase(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SHARED_ARENA_H__ */
+
+/************************ (C) COPYRIGHT FMSH *****END OF FILE****/
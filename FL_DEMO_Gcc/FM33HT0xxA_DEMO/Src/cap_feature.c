@@ -0,0 +1,447 @@
+/* ===========================================  Includes  =========================================== */
+#include "cap_feature.h"
+#include "hello_world_test.h"
+
+/* include TSI library header files */
+#include "tsi.h"
+#include "tsi_object.h"
+#include "tsi_plugin.h"
+#include <string.h>
+
+/* ============================================  Define  ============================================ */
+/* USER CONFIGURATION BEGIN */
+/* Plugin call priority(0-7). Lower value means higher priority. */
+#define CAP_FEATURE_PRIORITY            "2"
+
+/* Invoke once every N frames after the window is filled */
+#define CAP_FEATURE_STRIDE              (4U)
+
+/* diffCount per model input unit */
+#define CAP_FEATURE_COUNT_PER_UNIT      (100)
+
+/* Detection threshold on model output (real value) */
+#define CAP_FEATURE_SCORE_TH            (0.5f)
+
+/* 1: windows are queued and scored by CapFeature_Process() from main loop,
+   0: scored inside the TSI callback, delaying the next scan by Invoke() time.
+      The window is copied straight into the input tensor, no ring */
+#define CAP_FEATURE_ASYNC               (1U)
+
+/* Queued windows, oldest is dropped when full. Async only */
+#define CAP_FEATURE_RING_NUM            (2U)
+
+/* Max window bytes (model input tensor size) */
+#define CAP_FEATURE_WINDOW_MAX          (64U)
+
+/* Gate before the model, window is scored only if any enabled condition holds.
+   0 disables the gate and every stride is scored */
+#define CAP_FEATURE_GATE_NOISE          (1U << 0)   /* Feature sensor diffCount > noiseTh */
+#define CAP_FEATURE_GATE_STATUS         (1U << 1)   /* Feature widget active */
+#define CAP_FEATURE_GATE_PROX           (1U << 2)   /* Any proximity widget approaching or active */
+#define CAP_FEATURE_GATE                (CAP_FEATURE_GATE_NOISE | CAP_FEATURE_GATE_STATUS | \
+                                         CAP_FEATURE_GATE_PROX)
+
+/* Frames the gate stays open after the last hit, lets the model see the release */
+#define CAP_FEATURE_GATE_HOLD           (8U)
+/* USER CONFIGURATION END */
+
+/* ===========================================  Typedef  ============================================ */
+#if (CAP_FEATURE_ASYNC == 1U)
+/* One published feature window */
+typedef struct
+{
+    uint32_t frameSeq;                  /* Frame count when published */
+#if (TSI_USE_TIMEBASE == 1U)
+    uint32_t tick;                      /* TSI tick when published */
+#endif  /* TSI_USE_TIMEBASE == 1U */
+    int8_t data[CAP_FEATURE_WINDOW_MAX];
+} CapFeatureWindowTypeDef;
+#endif  /* CAP_FEATURE_ASYNC == 1U */
+
+/* ==========================================  Variables  =========================================== */
+/* Widgets whose sensor diffCounts form one feature frame, in channel order */
+static TSI_WidgetTypeDef *const capFeatureWidgets[] = {
+    (TSI_WidgetTypeDef *) &TSI_WidgetList.Button_ExPad1_MC,
+    (TSI_WidgetTypeDef *) &TSI_WidgetList.Button_ExPad1_Rx,
+    (TSI_WidgetTypeDef *) &TSI_WidgetList.Button_ExPad1_Tx,
+};
+
+/* Model input/output tensors, window is copied into input tensor before Invoke().
+   The planner reuses the input buffer for later activations, so the sliding
+   window cannot be kept in the tensor itself */
+static TSI_LibHandleTypeDef *capHandle;
+static CapTensorTypeDef capInput;
+static CapTensorTypeDef capOutput;
+static int8_t capWindow[CAP_FEATURE_WINDOW_MAX];
+static uint16_t frameLen;           /* Channels per frame */
+static uint16_t windowDepth;        /* Frames per window */
+static uint16_t frameCnt;           /* Valid frames in window */
+static uint16_t strideCnt;
+
+/* Fixed-point quantization: q = ((diff * quantMult) >> 16) + zeroPoint */
+static int32_t quantMult;
+static int32_t diffLimit;
+
+/* Raw int8 output and threshold quantized with output params */
+static int8_t scoreQ;
+static int8_t scoreThQ;
+static uint32_t inferCnt;
+
+#if (CAP_FEATURE_ASYNC == 1U)
+/* Window ring between TSI callback (producer) and CapFeature_Process().
+   The TSI callback slides capWindow on every frame before the queued one is scored */
+static CapFeatureWindowTypeDef capRing[CAP_FEATURE_RING_NUM];
+static volatile uint8_t ringHead;   /* Next slot to write */
+static volatile uint8_t ringCount;  /* Queued windows */
+#endif  /* CAP_FEATURE_ASYNC == 1U */
+static uint32_t frameSeq;
+static CapFeatureSchedStatsTypeDef schedStats;
+static uint16_t gateHoldCnt;        /* Frames left before the gate closes */
+
+/* ====================================  Functions declaration  ===================================== */
+static void CapFeature_StartedCallback(TSI_LibHandleTypeDef *handle);
+static void CapFeature_ValueUpdatedCallback(TSI_LibHandleTypeDef *handle);
+static void CapFeature_PushFrame(void);
+#if (CAP_FEATURE_ASYNC == 1U)
+static uint8_t CapFeature_NextScanStarted(void);
+static void CapFeature_Publish(void);
+#endif  /* CAP_FEATURE_ASYNC == 1U */
+static uint8_t CapFeature_Score(const int8_t *window);
+static uint8_t CapFeature_GateHit(void);
+static int8_t CapFeature_Quantize(int32_t diff);
+
+/* ======================================  Functions define  ======================================== */
+/*Dequantize only when the real value is needed*/
+float CapFeature_GetScore(void)
+{
+    return (float)(scoreQ - capOutput.zeroPoint) * capOutput.scale;
+}
+
+uint8_t CapFeature_IsDetected(void)
+{
+    return (inferCnt != 0U && scoreQ >= scoreThQ) ? 1U : 0U;
+}
+
+uint32_t CapFeature_GetInferenceCount(void)
+{
+    return inferCnt;
+}
+
+void CapFeature_GetSchedStats(CapFeatureSchedStatsTypeDef *stats)
+{
+    if (stats != NULL) {
+        *stats = schedStats;
+    }
+}
+
+/*Score the newest queued window, older ones are coalesced (dropped).
+  Call from main loop after TSI_Handler(). Scoring waits until TSI_Handler()
+  has started the next scan, so Invoke() runs while the hardware scans.
+  Nothing to do when scored inside the TSI callback*/
+uint8_t CapFeature_Process(void)
+{
+#if (CAP_FEATURE_ASYNC == 1U)
+    const CapFeatureWindowTypeDef *pWindow;
+    uint32_t latency;
+    uint8_t newest;
+
+    if (capInput.data == NULL || ringCount == 0U) {
+        return 0U;
+    }
+    if (CapFeature_NextScanStarted() == 0U) {
+        return 0U;
+    }
+
+    newest = (uint8_t)((ringHead + CAP_FEATURE_RING_NUM - 1U) % CAP_FEATURE_RING_NUM);
+    pWindow = &capRing[newest];
+    schedStats.droppedCnt += (uint32_t)ringCount - 1U;
+    ringCount = 0U;
+
+    if (CapFeature_Score(pWindow->data) == 0U) {
+        return 0U;
+    }
+
+    latency = frameSeq - pWindow->frameSeq;
+    schedStats.latencyFrames = latency;
+    if (latency > schedStats.maxLatencyFrames) {
+        schedStats.maxLatencyFrames = latency;
+    }
+#if (TSI_USE_TIMEBASE == 1U)
+    latency = TSI_GetTick(capHandle) - pWindow->tick;
+    schedStats.latencyTicks = latency;
+    if (latency > schedStats.maxLatencyTicks) {
+        schedStats.maxLatencyTicks = latency;
+    }
+#endif  /* TSI_USE_TIMEBASE == 1U */
+    return 1U;
+#else
+    return 0U;
+#endif  /* CAP_FEATURE_ASYNC == 1U */
+}
+
+static uint8_t CapFeature_Score(const int8_t *window)
+{
+    memcpy(capInput.data, window, capInput.size);
+    if (CapClassificationInvoke() != 0) {
+        return 0U;
+    }
+    scoreQ = ((int8_t *)capOutput.data)[0];
+    inferCnt++;
+    return 1U;
+}
+
+#if (CAP_FEATURE_ASYNC == 1U)
+
+/*With the scan timebase the next scan starts on the interval timer, not
+  after processing. Invoking before that start would push it back by the
+  Invoke() time. Returns 1 if no scan is due, e.g. library stopped or in LPM*/
+static uint8_t CapFeature_NextScanStarted(void)
+{
+#if ((TSI_USE_TIMEBASE == 1U) && (TSI_SCAN_USE_TIMEBASE == 1U))
+    if (capHandle->status != TSI_LIB_RUNNING) {
+        return 1U;
+    }
+#if (TSI_USED_IN_LPM_MODE == 1U)
+    if (capHandle->isLPM != 0U) {
+        return 1U;
+    }
+#endif  /* TSI_USED_IN_LPM_MODE == 1U */
+    return (TSI_DRV_GET_STAT(capHandle->driver,
+                             TSI_DRV_STAT_SCAN_RUNNING | TSI_DRV_STAT_SCAN_CPLT) != 0U) ? 1U : 0U;
+#else
+    /* TSI_Handler() starts the next scan right after processing */
+    return 1U;
+#endif  /* (TSI_USE_TIMEBASE == 1U) && (TSI_SCAN_USE_TIMEBASE == 1U) */
+}
+#endif  /* CAP_FEATURE_ASYNC == 1U */
+
+/*Bind to model input tensor, model shall be setup before TSI_Start()*/
+static void CapFeature_StartedCallback(TSI_LibHandleTypeDef *handle)
+{
+    uint16_t channelNum = 0U;
+    float unit;
+    float th;
+
+    capHandle = handle;
+    memset(&capInput, 0, sizeof(capInput));
+    memset(&schedStats, 0, sizeof(schedStats));
+    frameCnt = 0U;
+    strideCnt = 0U;
+    inferCnt = 0U;
+#if (CAP_FEATURE_ASYNC == 1U)
+    ringHead = 0U;
+    ringCount = 0U;
+#endif  /* CAP_FEATURE_ASYNC == 1U */
+    frameSeq = 0U;
+    gateHoldCnt = 0U;
+
+    /* Graph must be fully integer, float I/O costs soft-float ops per frame */
+    if (CapClassificationGetInput(&capInput) != 0 || capInput.size == 0U ||
+        capInput.size > CAP_FEATURE_WINDOW_MAX || capInput.isInt8 == 0U ||
+        CapClassificationGetOutput(&capOutput) != 0 || capOutput.isInt8 == 0U) {
+        capInput.data = NULL;
+        return;
+    }
+
+    TSI_FOREACH_OBJ(TSI_WidgetTypeDef *const *, ppWidget, capFeatureWidgets,
+                    sizeof(capFeatureWidgets) / sizeof(capFeatureWidgets[0])) {
+        channelNum += (*ppWidget)->meta->sensorNum;
+    }
+    TSI_FOREACH_END()
+
+    /* Input smaller than one frame: keep the leading channels only */
+    frameLen = (capInput.size < channelNum) ? (uint16_t)capInput.size : channelNum;
+    if (frameLen == 0U) {
+        capInput.data = NULL;
+        return;
+    }
+    windowDepth = (uint16_t)(capInput.size / frameLen);
+    memcpy(capWindow, capInput.data, capInput.size);
+
+    unit = capInput.scale * (float)CAP_FEATURE_COUNT_PER_UNIT;
+    quantMult = (int32_t)(65536.0f / unit + 0.5f);
+    /* Beyond this the result saturates anyway, keeps product in range */
+    diffLimit = (int32_t)(256.0f * unit) + 1;
+
+    /* Round threshold up so that scoreQ >= scoreThQ means score >= TH */
+    th = CAP_FEATURE_SCORE_TH / capOutput.scale + (float)capOutput.zeroPoint;
+    if (th > 127.0f) {
+        scoreThQ = 127;
+    } else if (th < -128.0f) {
+        scoreThQ = -128;
+    } else {
+        int32_t thQ = (int32_t)th;
+        if ((float)thQ < th) {
+            thQ++;
+        }
+        scoreThQ = (int8_t)thQ;
+    }
+}
+
+static void CapFeature_ValueUpdatedCallback(TSI_LibHandleTypeDef *handle)
+{
+    TSI_UNUSED(handle)
+
+    if (capInput.data == NULL) {
+        return;
+    }
+
+    CapFeature_PushFrame();
+    frameSeq++;
+
+    if (CapFeature_GateHit() != 0U) {
+        gateHoldCnt = CAP_FEATURE_GATE_HOLD;
+    } else if (gateHoldCnt != 0U) {
+        gateHoldCnt--;
+    }
+
+    if (frameCnt < windowDepth) {
+        frameCnt++;
+    }
+    strideCnt++;
+    if (frameCnt < windowDepth || strideCnt < CAP_FEATURE_STRIDE) {
+        return;
+    }
+    strideCnt = 0U;
+
+    /* Idle frame: keep the window sliding, skip the model */
+    if (gateHoldCnt == 0U) {
+        schedStats.gateSkipCnt++;
+        scoreQ = INT8_MIN;
+        return;
+    }
+    schedStats.gatePassCnt++;
+
+#if (CAP_FEATURE_ASYNC == 1U)
+    CapFeature_Publish();
+#else
+    (void)CapFeature_Score(capWindow);
+#endif  /* CAP_FEATURE_ASYNC == 1U */
+}
+
+#if (CAP_FEATURE_ASYNC == 1U)
+/*Queue a copy of the window, overwrite the oldest one when inference falls behind*/
+static void CapFeature_Publish(void)
+{
+    CapFeatureWindowTypeDef *pWindow = &capRing[ringHead];
+
+    memcpy(pWindow->data, capWindow, capInput.size);
+    pWindow->frameSeq = frameSeq;
+#if (TSI_USE_TIMEBASE == 1U)
+    pWindow->tick = TSI_GetTick(capHandle);
+#endif  /* TSI_USE_TIMEBASE == 1U */
+
+    ringHead = (uint8_t)((ringHead + 1U) % CAP_FEATURE_RING_NUM);
+    if (ringCount < CAP_FEATURE_RING_NUM) {
+        ringCount++;
+    } else {
+        schedStats.droppedCnt++;
+    }
+    schedStats.publishedCnt++;
+}
+#endif  /* CAP_FEATURE_ASYNC == 1U */
+
+/*Cheap stage of the cascade, only TSI state already computed for this frame*/
+static uint8_t CapFeature_GateHit(void)
+{
+#if (CAP_FEATURE_GATE == 0U)
+    return 1U;
+#else
+#if ((CAP_FEATURE_GATE & (CAP_FEATURE_GATE_NOISE | CAP_FEATURE_GATE_STATUS)) != 0U)
+    TSI_FOREACH_OBJ(TSI_WidgetTypeDef *const *, ppWidget, capFeatureWidgets,
+                    sizeof(capFeatureWidgets) / sizeof(capFeatureWidgets[0])) {
+#if ((CAP_FEATURE_GATE & CAP_FEATURE_GATE_STATUS) != 0U)
+        if ((*ppWidget)->status != 0U) {
+            return 1U;
+        }
+#endif  /* CAP_FEATURE_GATE & CAP_FEATURE_GATE_STATUS */
+#if ((CAP_FEATURE_GATE & CAP_FEATURE_GATE_NOISE) != 0U)
+        TSI_FOREACH_OBJ(TSI_SensorTypeDef *, pSensor, (*ppWidget)->meta->sensors,
+                        (*ppWidget)->meta->sensorNum) {
+            if (pSensor->diffCount > (int32_t)(*ppWidget)->detConf.noiseTh) {
+                return 1U;
+            }
+        }
+        TSI_FOREACH_END()
+#endif  /* CAP_FEATURE_GATE & CAP_FEATURE_GATE_NOISE */
+    }
+    TSI_FOREACH_END()
+#endif  /* CAP_FEATURE_GATE & (CAP_FEATURE_GATE_NOISE | CAP_FEATURE_GATE_STATUS) */
+
+#if ((CAP_FEATURE_GATE & CAP_FEATURE_GATE_PROX) != 0U)
+    TSI_FOREACH_OBJ(TSI_WidgetTypeDef **, ppWidget, capHandle->widgets,
+                    capHandle->widgetNum) {
+        if ((*ppWidget)->enable == TSI_WIDGET_ENABLE &&
+            (*ppWidget)->meta->type == TSI_WIDGET_SELF_CAP_PROXIMITY &&
+            ((*ppWidget)->status != 0U || (*ppWidget)->meta->sensors[0U].diffCount > 0)) {
+            return 1U;
+        }
+    }
+    TSI_FOREACH_END()
+#endif  /* CAP_FEATURE_GATE & CAP_FEATURE_GATE_PROX */
+    return 0U;
+#endif  /* CAP_FEATURE_GATE == 0U */
+}
+
+/*Slide window by one frame and write newest frame at the tail*/
+static void CapFeature_PushFrame(void)
+{
+    int8_t *window = capWindow;
+    uint32_t tail = (uint32_t)(windowDepth - 1U) * frameLen;
+    uint16_t ch = 0U;
+
+    if (windowDepth > 1U) {
+        memmove(window, window + frameLen, tail);
+    }
+
+    TSI_FOREACH_OBJ(TSI_WidgetTypeDef *const *, ppWidget, capFeatureWidgets,
+                    sizeof(capFeatureWidgets) / sizeof(capFeatureWidgets[0])) {
+        TSI_FOREACH_OBJ(TSI_SensorTypeDef *, pSensor, (*ppWidget)->meta->sensors,
+                        (*ppWidget)->meta->sensorNum) {
+            if (ch >= frameLen) {
+                return;
+            }
+            window[tail + ch] = CapFeature_Quantize(pSensor->diffCount);
+            ch++;
+        }
+        TSI_FOREACH_END()
+    }
+    TSI_FOREACH_END()
+}
+
+static int8_t CapFeature_Quantize(int32_t diff)
+{
+    int32_t q;
+
+    if (diff > diffLimit) {
+        diff = diffLimit;
+    } else if (diff < -diffLimit) {
+        diff = -diffLimit;
+    }
+
+    q = ((diff * quantMult + 0x8000) >> 16) + capInput.zeroPoint;
+    if (q > 127) {
+        q = 127;
+    } else if (q < -128) {
+        q = -128;
+    }
+    return (int8_t)q;
+}
+
+/* Plugin registration ------------------------------------------------------*/
+TSI_PLUGIN(CapFeature, CAP_FEATURE_PRIORITY)
+{
+    NULL,                               /* initCompleted */
+    NULL,                               /* deInitCompleted */
+    CapFeature_StartedCallback,         /* started */
+    NULL,                               /* stopped */
+    NULL,                               /* widgetInitCompleted */
+    NULL,                               /* widgetScanCompleted */
+    CapFeature_ValueUpdatedCallback,    /* widgetValueUpdated */
+    NULL,                               /* widgetStatusUpdated */
+    NULL,                               /* getInitScanBufferAndCount */
+    NULL,                               /* processInitScanValue */
+    NULL,                               /* processInitScanSample */
+};
+
+/* =============================================  EOF  ============================================== */
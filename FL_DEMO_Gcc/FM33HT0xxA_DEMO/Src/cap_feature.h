@@ -0,0 +1,42 @@
+#ifndef __CAP_FEATURE_H__
+#define __CAP_FEATURE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+/* ============================================  Define  ============================================ */
+
+/* ===========================================  Typedef  ============================================ */
+/* Inference scheduling counters, cleared on TSI start */
+typedef struct
+{
+    uint32_t publishedCnt;      /* Windows queued by the TSI callback */
+    uint32_t droppedCnt;        /* Windows overwritten or coalesced, never scored */
+    uint32_t latencyFrames;     /* Frames from publish to score, last inference */
+    uint32_t maxLatencyFrames;
+    uint32_t latencyTicks;      /* TSI ticks from publish to score, timebase only */
+    uint32_t maxLatencyTicks;
+    uint32_t gatePassCnt;       /* Strides passed by the gate to the model */
+    uint32_t gateSkipCnt;       /* Strides skipped as idle, no inference */
+} CapFeatureSchedStatsTypeDef;
+
+/* ==========================================  Variables  =========================================== */
+
+/* ====================================  Functions declaration  ===================================== */
+float CapFeature_GetScore(void);
+uint8_t CapFeature_IsDetected(void);
+uint32_t CapFeature_GetInferenceCount(void);
+void CapFeature_GetSchedStats(CapFeatureSchedStatsTypeDef *stats);
+uint8_t CapFeature_Process(void);
+/* ======================================  Functions define  ======================================== */
+
+/* =============================================  EOF  ============================================== */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif  /* __cplusplus */
+
+#endif
@@ -0,0 +1,160 @@
+/* ===========================================  Includes  =========================================== */
+#include "cap_profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__arm__)
+/* BSTIM16 cycle counter on target */
+#include "cycle_counter.h"
+#define CAP_PROFILER_TICK_MASK      (CYCLE_COUNTER_MASK)
+#else
+/* steady clock on host */
+#include <chrono>
+#define CAP_PROFILER_TICK_MASK      (0xFFFFFFFFU)
+#endif
+
+/* ============================================  Define  ============================================ */
+#define CAP_PROFILER_INVALID_HANDLE (0xFFFFFFFFU)
+
+/* ==========================================  Variables  =========================================== */
+namespace {
+CapProfiler profiler;
+char csv_buffer[CAP_PROFILER_CSV_SIZE];
+
+/* ====================================  Functions define  ===================================== */
+uint32_t ReadTicks(void)
+{
+#if defined(__arm__)
+  return CycleCounter_Read();
+#else
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+}  // namespace
+
+/*Tags are op names with static lifetime, compare pointers before strings*/
+int CapProfiler::FindExistingOrNextPosition(const char *tag)
+{
+  for (int i = 0; i < tagNum_; ++i) {
+    if (tags_[i].tag == tag || strcmp(tags_[i].tag, tag) == 0) {
+      return i;
+    }
+  }
+  if (tagNum_ >= CAP_PROFILER_MAX_TAGS) {
+    return -1;
+  }
+  tags_[tagNum_].tag = tag;
+  tags_[tagNum_].count = 0U;
+  tags_[tagNum_].ticks = 0U;
+  return tagNum_++;
+}
+
+uint32_t CapProfiler::BeginEvent(const char *tag)
+{
+  int tagIdx = FindExistingOrNextPosition(tag);
+  if (tagIdx < 0) {
+    return CAP_PROFILER_INVALID_HANDLE;
+  }
+  for (uint32_t i = 0U; i < CAP_PROFILER_MAX_OPEN; ++i) {
+    if ((openMask_ & (1U << i)) == 0U) {
+      openMask_ |= (1U << i);
+      open_[i].tagIdx = tagIdx;
+      open_[i].start = ReadTicks();
+      return i;
+    }
+  }
+  return CAP_PROFILER_INVALID_HANDLE;
+}
+
+void CapProfiler::EndEvent(uint32_t event_handle)
+{
+  uint32_t end = ReadTicks();
+  if (event_handle >= CAP_PROFILER_MAX_OPEN || (openMask_ & (1U << event_handle)) == 0U) {
+    return;
+  }
+  openMask_ &= ~(1U << event_handle);
+
+  TicksPerTag &entry = tags_[open_[event_handle].tagIdx];
+  entry.ticks += (end - open_[event_handle].start) & CAP_PROFILER_TICK_MASK;
+  entry.count++;
+}
+
+void CapProfiler::ClearEvents()
+{
+  tagNum_ = 0;
+  openMask_ = 0U;
+}
+
+uint32_t CapProfiler::GetTotalTicks() const
+{
+  uint32_t total = 0U;
+  for (int i = 0; i < tagNum_; ++i) {
+    total += tags_[i].ticks;
+  }
+  return total;
+}
+
+uint32_t CapProfiler::LogTicksPerTagCsv(char *buf, uint32_t size) const
+{
+  if (buf == nullptr || size == 0U) {
+    return 0U;
+  }
+
+  int len = snprintf(buf, size, "tag,count,ticks\n");
+  for (int i = 0; i < tagNum_ && len >= 0 && (uint32_t)len < size; ++i) {
+    int n = snprintf(buf + len, size - len, "%.*s,%lu,%lu\n", CAP_PROFILER_TAG_MAX,
+                     tags_[i].tag, (unsigned long)tags_[i].count,
+                     (unsigned long)tags_[i].ticks);
+    if (n < 0) {
+      break;
+    }
+    len += n;
+  }
+  if (len < 0) {
+    buf[0] = '\0';
+    return 0U;
+  }
+  return ((uint32_t)len < size) ? (uint32_t)len : size - 1U;
+}
+
+tflite::MicroProfilerInterface *CapProfiler_Get(void)
+{
+  return &profiler;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+/*Start the tick source, call before the first Invoke()*/
+int CapProfiler_Init(void)
+{
+  profiler.ClearEvents();
+#if defined(__arm__)
+  if (CycleCounter_Init() != FL_PASS) {
+    return -1;
+  }
+#endif
+  return 0;
+}
+
+void CapProfiler_Clear(void)
+{
+  profiler.ClearEvents();
+}
+
+/*Snapshot per-op ticks as CSV into a static buffer, valid until next call*/
+uint32_t CapProfiler_GetCsv(const char **csv)
+{
+  uint32_t len = profiler.LogTicksPerTagCsv(csv_buffer, sizeof(csv_buffer));
+  if (csv != nullptr) {
+    *csv = csv_buffer;
+  }
+  return len;
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif  /* __cplusplus */
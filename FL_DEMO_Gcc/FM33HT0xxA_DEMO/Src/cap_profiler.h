@@ -0,0 +1,78 @@
+#ifndef __CAP_PROFILER_H__
+#define __CAP_PROFILER_H__
+
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+#ifdef __cplusplus
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#endif  /* __cplusplus */
+
+/* ============================================  Define  ============================================ */
+/* Unique tags (op names) kept, ops beyond this are not profiled */
+#define CAP_PROFILER_MAX_TAGS       (8)
+
+/* Events open at the same time */
+#define CAP_PROFILER_MAX_OPEN       (4)
+
+/* Tag characters kept in a CSV row, longer op names are cut */
+#define CAP_PROFILER_TAG_MAX        (24)
+
+/* CSV snapshot buffer size: header "tag,count,ticks\n", then per tag the name,
+   two 10-digit counters, 2 commas and '\n', plus the terminating '\0' */
+#define CAP_PROFILER_CSV_SIZE       (16 + CAP_PROFILER_MAX_TAGS * (CAP_PROFILER_TAG_MAX + 23) + 1)
+
+/* ===========================================  Typedef  ============================================ */
+#ifdef __cplusplus
+/*Per-tag profiler for MicroInterpreter. Unlike tflite::MicroProfiler, which
+  keeps every event (4096 slots, far above the RAM), only the tick sum and
+  event count of each tag are kept, accumulated across Invoke() calls.
+  Ticks are APB clock cycles from BSTIM16 on target, nanoseconds from a steady
+  clock on host*/
+class CapProfiler : public tflite::MicroProfilerInterface {
+ public:
+  uint32_t BeginEvent(const char *tag) override;
+  void EndEvent(uint32_t event_handle) override;
+
+  void ClearEvents();
+  uint32_t GetTotalTicks() const;
+
+  /*Write "tag,count,ticks" rows, return length without the terminating 0*/
+  uint32_t LogTicksPerTagCsv(char *buf, uint32_t size) const;
+
+ private:
+  struct TicksPerTag {
+    const char *tag;
+    uint32_t count;
+    uint32_t ticks;
+  };
+  struct OpenEvent {
+    int tagIdx;
+    uint32_t start;
+  };
+
+  int FindExistingOrNextPosition(const char *tag);
+
+  TicksPerTag tags_[CAP_PROFILER_MAX_TAGS] = {};
+  int tagNum_ = 0;
+  OpenEvent open_[CAP_PROFILER_MAX_OPEN] = {};
+  uint32_t openMask_ = 0U;
+};
+
+tflite::MicroProfilerInterface *CapProfiler_Get(void);
+#endif  /* __cplusplus */
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+/* ====================================  Functions declaration  ===================================== */
+int CapProfiler_Init(void);
+void CapProfiler_Clear(void);
+uint32_t CapProfiler_GetCsv(const char **csv);
+/* =============================================  EOF  ============================================== */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif  /* __cplusplus */
+
+#endif
@@ -0,0 +1,127 @@
+/**
+  ****************************************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ****************************************************************************************************
+  */
+  
+#include "cycle_counter.h"
+#include "fm33ht0xxa_fl.h"
+
+/* 计数器溢出次数, 作为32位计数值的高16位 */
+static volatile uint32_t cycleCounterHigh = 0U;
+static uint8_t cycleCounterReady = 0U;
+
+/**
+  * @brief  周期计数器初始化, BSTIM16以APB时钟不分频自由计数
+  *         SysTick被FL_DelayMs()占用, 性能统计使用独立定时器
+  *         16位计数器几毫秒即回绕, 更新中断(MUX18)累计溢出次数扩展为32位
+  *         多个使用者共用, 已启动时直接返回, 不会清零计数
+  * @param  None
+  * @retval FL_PASS: 初始化成功
+  */
+FL_ErrorStatus CycleCounter_Init(void)
+{
+    FL_BSTIM16_InitTypeDef init;
+    FL_ErrorStatus status;
+
+    if(cycleCounterReady != 0U)
+    {
+        return FL_PASS;
+    }
+
+    init.prescaler = 0U;
+    init.autoReload = 0xFFFFU;
+    init.autoReloadState = FL_DISABLE;
+    init.clockSource = FL_CMU_BSTIM16_CLK_SOURCE_APBCLK;
+    status = FL_BSTIM16_Init(BSTIM16, &init);
+    if(status != FL_PASS)
+    {
+        return status;
+    }
+
+    /* 使能更新中断 */
+    cycleCounterHigh = 0U;
+    FL_BSTIM16_ClearFlag_Update(BSTIM16);
+    FL_BSTIM16_EnableIT_Update(BSTIM16);
+
+    /* 配置INTMUX及NVIC */
+    FL_INTMUX_SetMUX18SEL(FL_INTMUX_MUX18SEL_BSTIM);
+    NVIC_DisableIRQ(MUX18_IRQn);
+    NVIC_ClearPendingIRQ(MUX18_IRQn);
+    NVIC_SetPriority(MUX18_IRQn, CYCLE_COUNTER_IRQ_PRIORITY);
+    NVIC_EnableIRQ(MUX18_IRQn);
+
+    /* 启动定时器 */
+    FL_BSTIM16_Enable(BSTIM16);
+    cycleCounterReady = 1U;
+
+    return status;
+}
+
+/**
+  * @brief  周期计数器溢出处理, 在MUX18中断中调用
+  * @param  None
+  * @retval None
+  */
+void CycleCounter_IrqHandler(void)
+{
+    if((FL_BSTIM16_IsEnabledIT_Update(BSTIM16) != 0U) &&
+            (FL_BSTIM16_IsActiveFlag_Update(BSTIM16) != 0U))
+    {
+        FL_BSTIM16_ClearFlag_Update(BSTIM16);
+        cycleCounterHigh++;
+    }
+}
+
+/**
+  * @brief  读取周期计数值(APB时钟周期), 向上计数
+  *         关中断时也可调用: 溢出标志已置位但中断未处理时补计一次
+  * @param  None
+  * @retval 当前计数值, 有效位宽见CYCLE_COUNTER_MASK
+  */
+uint32_t CycleCounter_Read(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t high;
+    uint32_t low;
+
+    __disable_irq();
+    high = cycleCounterHigh;
+    low = FL_BSTIM16_ReadCounter(BSTIM16);
+    if(FL_BSTIM16_IsActiveFlag_Update(BSTIM16) != 0U)
+    {
+        /* 回绕后重新读数, 确保低16位与补计的高位一致 */
+        low = FL_BSTIM16_ReadCounter(BSTIM16);
+        high++;
+    }
+    __set_PRIMASK(primask);
+
+    return (high << 16U) | (low & 0xFFFFU);
+}
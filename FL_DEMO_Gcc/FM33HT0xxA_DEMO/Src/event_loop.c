@@ -0,0 +1,260 @@
+/**
+  ****************************************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ****************************************************************************************************
+  */
+  
+#include "event_loop.h"
+#include "cycle_counter.h"
+#include "fm33ht0xxa_fl.h"
+
+/* 待处理事件, 中断置位 */
+static volatile uint32_t eventPending = 0U;
+
+/* 节拍计数, 时基中断累加 */
+static volatile uint32_t eventTick = 0U;
+
+/* 节拍周期(us), 每us的APB周期数, 心跳及统计窗口(节拍) */
+static uint32_t eventTickUs = 1000U;
+static uint32_t eventCyclesPerUs = 24U;
+static uint32_t eventBeatTicks = EVENT_HEARTBEAT_MS;
+static uint32_t eventDutyTicks = EVENT_DUTY_WINDOW_MS;
+
+/* 扫描完成时间戳, 每帧只记录第一次中断 */
+static volatile uint32_t scanStampCycle = 0U;
+static volatile uint8_t scanStamped = 0U;
+
+/* 本心跳周期内已报到的对象 */
+static uint32_t aliveMask = 0U;
+static uint32_t beatTick = 0U;
+
+/* 统计窗口起点及窗口内休眠周期数 */
+static uint32_t dutyTick = 0U;
+static uint32_t sleepCycles = 0U;
+
+static EventLoop_StatsTypeDef eventStats;
+
+/**
+  * @brief  事件循环初始化, WFI进入Sleep模式, 启动周期计数器用于统计
+  * @param  u32TickUs 时基节拍周期(us)
+  * @retval FL_FAIL: 初始化失败
+  *         FL_PASS: 初始化成功
+  */
+FL_ErrorStatus EventLoop_Init(uint32_t u32TickUs)
+{
+    if((u32TickUs == 0U) || (SystemCoreClock < 1000000U))
+    {
+        return FL_FAIL;
+    }
+
+    eventTickUs = u32TickUs;
+    /* APB1不分频, 周期计数器以系统时钟计数 */
+    eventCyclesPerUs = SystemCoreClock / 1000000U;
+    eventBeatTicks = (EVENT_HEARTBEAT_MS * 1000U) / u32TickUs;
+    eventDutyTicks = (EVENT_DUTY_WINDOW_MS * 1000U) / u32TickUs;
+
+    /* DeepSleep停止高速时钟, TSI扫描及串口需保持运行 */
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+    beatTick = eventTick;
+    dutyTick = eventTick;
+    sleepCycles = 0U;
+    aliveMask = 0U;
+
+    return CycleCounter_Init();
+}
+
+/**
+  * @brief  等待事件, 无事件时WFI休眠
+  *         关中断后检查事件再WFI, 挂起的中断仍可唤醒, 检查与休眠之间的事件不会丢失
+  * @param  None
+  * @retval 取出的事件位, 同时清除
+  */
+uint32_t EventLoop_Wait(void)
+{
+    uint32_t events;
+    uint32_t start;
+
+    __disable_irq();
+    while(eventPending == 0U)
+    {
+        start = CycleCounter_Read();
+        __WFI();
+        /* 唤醒后中断尚未执行, 此处读数即休眠结束时刻 */
+        sleepCycles += (CycleCounter_Read() - start) & CYCLE_COUNTER_MASK;
+        eventStats.wakeCnt++;
+        __enable_irq();
+        __disable_irq();
+    }
+    events = eventPending;
+    eventPending = 0U;
+    __enable_irq();
+
+    return events;
+}
+
+/**
+  * @brief  置位事件, 可在不同优先级中断中调用
+  * @param  u32Events 事件位, EVENT_x
+  * @retval None
+  */
+void EventLoop_Set(uint32_t u32Events)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    eventPending |= u32Events;
+    __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  时基节拍, 在时基中断中调用
+  * @param  u32Ticks 本次中断经过的节拍数, 低功耗模式下时基周期延长时大于1
+  * @retval None
+  */
+void EventLoop_TickIrq(uint32_t u32Ticks)
+{
+    eventTick += u32Ticks;
+    EventLoop_Set(EVENT_TICK);
+}
+
+/**
+  * @brief  TSI扫描完成, 在TSI中断中调用, 记录延迟统计起点
+  * @param  None
+  * @retval None
+  */
+void EventLoop_ScanIrq(void)
+{
+    if(scanStamped == 0U)
+    {
+        scanStampCycle = CycleCounter_Read();
+        scanStamped = 1U;
+    }
+    EventLoop_Set(EVENT_TSI_SCAN);
+}
+
+/**
+  * @brief  一帧处理完成, 在TSI_WidgetUpdateCpltCallback中调用
+  *         TSI对象报到, 并统计扫描完成中断到回调的延迟
+  * @param  None
+  * @retval None
+  */
+void EventLoop_ScanProcessed(void)
+{
+    uint32_t us;
+
+    EventLoop_Alive(EVENT_ALIVE_TSI);
+    eventStats.scanCnt++;
+
+    /* 低功耗模式阻塞扫描无中断时间戳 */
+    if(scanStamped == 0U)
+    {
+        return;
+    }
+    us = ((CycleCounter_Read() - scanStampCycle) & CYCLE_COUNTER_MASK) / eventCyclesPerUs;
+    scanStamped = 0U;
+
+    eventStats.latencyUs = us;
+    if(us > eventStats.latencyMaxUs)
+    {
+        eventStats.latencyMaxUs = us;
+    }
+}
+
+/**
+  * @brief  被监督对象报到
+  * @param  u32Alive 报到对象, EVENT_ALIVE_x
+  * @retval None
+  */
+void EventLoop_Alive(uint32_t u32Alive)
+{
+    aliveMask |= u32Alive;
+}
+
+/**
+  * @brief  心跳及CPU占用率统计, 在主循环处理节拍事件时调用
+  *         每个心跳周期检查一次, 所需对象均已报到才清狗, 否则等待看门狗复位
+  *         占用率窗口按RCLP节拍计时, 精度受RCLP频率偏差影响
+  * @param  u32Required 本周期需报到的对象, EVENT_ALIVE_x
+  * @retval None
+  */
+void EventLoop_Heartbeat(uint32_t u32Required)
+{
+    uint32_t now = eventTick;
+    uint32_t windowMs;
+    uint32_t sleepUs;
+    uint32_t idle;
+
+    /* 节拍周期大于1ms时窗口可能不足1ms, 继续累计到下次心跳 */
+    windowMs = ((now - dutyTick) * eventTickUs) / 1000U;
+    if(((now - dutyTick) >= eventDutyTicks) && (windowMs != 0U))
+    {
+        sleepUs = sleepCycles / eventCyclesPerUs;
+        idle = sleepUs / windowMs;
+        eventStats.busyPermille = (uint16_t)((idle >= 1000U) ? 0U : (1000U - idle));
+        dutyTick = now;
+        sleepCycles = 0U;
+    }
+
+    if((now - beatTick) < eventBeatTicks)
+    {
+        return;
+    }
+    beatTick = now;
+    if((aliveMask & u32Required) == u32Required)
+    {
+        IWDT_Clr();
+    }
+    else if(eventStats.missedBeatCnt < 0xFFFFU)
+    {
+        eventStats.missedBeatCnt++;
+    }
+    aliveMask = 0U;
+}
+
+/**
+  * @brief  获取统计
+  * @param  None
+  * @retval 统计结构体
+  */
+const EventLoop_StatsTypeDef *EventLoop_GetStats(void)
+{
+    return &eventStats;
+}
+
+/**
+  * @brief  清除最大延迟
+  * @param  None
+  * @retval None
+  */
+void EventLoop_ClearLatency(void)
+{
+    eventStats.latencyMaxUs = 0U;
+}
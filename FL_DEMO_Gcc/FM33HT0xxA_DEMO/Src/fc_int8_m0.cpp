@@ -0,0 +1,183 @@
+/* ===========================================  Includes  =========================================== */
+#include "fc_int8_m0.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+/* ===========================================  Typedef  ============================================ */
+namespace tflite {
+namespace {
+
+struct OpDataFcM0 {
+  OpDataFullyConnected base;    /* multiplier, shift, activation range, zero points */
+  int32_t *folded_bias;         /* bias with input zero point folded in */
+};
+
+/* ====================================  Functions define  ===================================== */
+void *Init(TfLiteContext *context, const char *buffer, size_t length)
+{
+  (void)buffer;
+  (void)length;
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpDataFcM0));
+}
+
+TfLiteStatus Prepare(TfLiteContext *context, TfLiteNode *node)
+{
+  MicroContext *micro_context = GetMicroContext(context);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  TFLITE_DCHECK(node->builtin_data != nullptr);
+  auto *data = static_cast<OpDataFcM0 *>(node->user_data);
+  const auto *params =
+      static_cast<const TfLiteFullyConnectedParams *>(node->builtin_data);
+
+  TfLiteTensor *input =
+      micro_context->AllocateTempInputTensor(node, kFullyConnectedInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor *filter =
+      micro_context->AllocateTempInputTensor(node, kFullyConnectedWeightsTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  TfLiteTensor *bias =
+      micro_context->AllocateTempInputTensor(node, kFullyConnectedBiasTensor);
+  TfLiteTensor *output =
+      micro_context->AllocateTempOutputTensor(node, kFullyConnectedOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, filter->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  if (bias != nullptr) {
+    TF_LITE_ENSURE_TYPES_EQ(context, bias->type, kTfLiteInt32);
+    TF_LITE_ENSURE(context, IsConstantTensor(bias));
+  }
+  /*Folding needs constant symmetric weights*/
+  TF_LITE_ENSURE(context, IsConstantTensor(filter));
+  TF_LITE_ENSURE_EQ(context, filter->params.zero_point, 0);
+
+  TF_LITE_ENSURE_STATUS(CalculateOpDataFullyConnected(
+      context, params->activation, input->type, input, filter, bias, output,
+      &data->base));
+
+  const RuntimeShape filter_shape = GetTensorShape(filter);
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int output_depth = filter_shape.Dims(filter_dim_count - 2);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  data->folded_bias = static_cast<int32_t *>(context->AllocatePersistentBuffer(
+      context, output_depth * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->folded_bias != nullptr);
+  fc_int8_m0::FoldInputOffset(-input->params.zero_point,
+                              GetTensorData<int8_t>(filter),
+                              bias != nullptr ? GetTensorData<int32_t>(bias) : nullptr,
+                              output_depth, accum_depth, data->folded_bias);
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  if (bias != nullptr) {
+    micro_context->DeallocateTempTfLiteTensor(bias);
+  }
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext *context, TfLiteNode *node)
+{
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const auto &data = *static_cast<const OpDataFcM0 *>(node->user_data);
+
+  const TfLiteEvalTensor *input =
+      micro::GetEvalInput(context, node, kFullyConnectedInputTensor);
+  const TfLiteEvalTensor *filter =
+      micro::GetEvalInput(context, node, kFullyConnectedWeightsTensor);
+  TfLiteEvalTensor *output =
+      micro::GetEvalOutput(context, node, kFullyConnectedOutputTensor);
+
+  const RuntimeShape filter_shape = micro::GetTensorShape(filter);
+  const RuntimeShape output_shape = micro::GetTensorShape(output);
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth = output_shape.Dims(output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+
+  fc_int8_m0::FullyConnected(FullyConnectedParamsQuantized(data.base),
+                             data.folded_bias, batches, output_depth, accum_depth,
+                             micro::GetTensorData<int8_t>(input),
+                             micro::GetTensorData<int8_t>(filter),
+                             micro::GetTensorData<int8_t>(output));
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+namespace fc_int8_m0 {
+
+void FoldInputOffset(int32_t input_offset, const int8_t *filter, const int32_t *bias,
+                     int output_depth, int accum_depth, int32_t *folded_bias)
+{
+  for (int out_c = 0; out_c < output_depth; ++out_c) {
+    int32_t filter_sum = 0;
+    for (int d = 0; d < accum_depth; ++d) {
+      filter_sum += *filter++;
+    }
+    folded_bias[out_c] = (bias != nullptr ? bias[out_c] : 0) + input_offset * filter_sum;
+  }
+}
+
+void FullyConnected(const FullyConnectedParams &params, const int32_t *folded_bias,
+                    int batches, int output_depth, int accum_depth,
+                    const int8_t *input, const int8_t *filter, int8_t *output)
+{
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_multiplier = params.output_multiplier;
+  const int output_shift = params.output_shift;
+  /*Fused ReLU/ReLU6 is already in the activation range*/
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  for (int b = 0; b < batches; ++b) {
+    const int8_t *filter_row = filter;
+    for (int out_c = 0; out_c < output_depth; ++out_c) {
+      const int8_t *x = input;
+      int32_t acc = folded_bias[out_c];
+      int d = accum_depth;
+
+      /*Thumb-1 has no SIMD MAC: 4-way unroll keeps LDRSB/MULS/ADDS back to
+        back and removes 3 of 4 loop branches*/
+      for (; d >= 4; d -= 4) {
+        acc += filter_row[0] * x[0];
+        acc += filter_row[1] * x[1];
+        acc += filter_row[2] * x[2];
+        acc += filter_row[3] * x[3];
+        filter_row += 4;
+        x += 4;
+      }
+      for (; d > 0; --d) {
+        acc += *filter_row++ * *x++;
+      }
+
+      acc = MultiplyByQuantizedMultiplier(acc, output_multiplier, output_shift);
+      acc += output_offset;
+      if (acc < output_activation_min) {
+        acc = output_activation_min;
+      } else if (acc > output_activation_max) {
+        acc = output_activation_max;
+      }
+      *output++ = static_cast<int8_t>(acc);
+    }
+    input += accum_depth;
+  }
+}
+
+}  // namespace fc_int8_m0
+
+TFLMRegistration Register_FULLY_CONNECTED_INT8_M0()
+{
+  return micro::RegisterOp(Init, Prepare, Eval);
+}
+
+}  // namespace tflite
@@ -0,0 +1,32 @@
+#ifndef __FC_INT8_M0_H__
+#define __FC_INT8_M0_H__
+
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/micro/micro_common.h"
+
+/* ====================================  Functions declaration  ===================================== */
+namespace tflite {
+
+/* int8 FullyConnected kernel for Cortex-M0 (Thumb-1, no DSP/SIMD), register with
+   MicroMutableOpResolver::AddFullyConnected(Register_FULLY_CONNECTED_INT8_M0()).
+   Only constant per-tensor int8 weights with zero point 0 are accepted */
+TFLMRegistration Register_FULLY_CONNECTED_INT8_M0();
+
+namespace fc_int8_m0 {
+
+/*folded_bias[o] = bias[o] + input_offset * sum(filter[o][:]), done once in Prepare*/
+void FoldInputOffset(int32_t input_offset, const int8_t *filter, const int32_t *bias,
+                     int output_depth, int accum_depth, int32_t *folded_bias);
+
+/*Bit-exact with reference_integer_ops::FullyConnected when weights_offset is 0*/
+void FullyConnected(const FullyConnectedParams &params, const int32_t *folded_bias,
+                    int batches, int output_depth, int accum_depth,
+                    const int8_t *input, const int8_t *filter, int8_t *output);
+
+}  // namespace fc_int8_m0
+}  // namespace tflite
+
+#endif
@@ -0,0 +1,229 @@
+/* ===========================================  Includes  =========================================== */
+#include "fc_pal4_m0.h"
+
+#include "fc_int8_m0.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+/* ===========================================  Typedef  ============================================ */
+namespace tflite {
+namespace {
+
+struct OpDataFcPal4 {
+  OpDataFullyConnected base;    /* multiplier, shift, activation range, zero points */
+  int32_t *folded_bias;         /* bias with input zero point folded in */
+  int scratch_index;            /* decoded tile, -1 for int8 filters */
+  int tile_rows;
+};
+
+/* ====================================  Functions define  ===================================== */
+uint16_t PackedU16(const uint8_t *p)
+{
+  return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+const int8_t *RowPalette(const uint8_t *packed, int row)
+{
+  const int palette_num = PackedU16(packed + 2);
+  return reinterpret_cast<const int8_t *>(packed + FC_PAL4_HEADER_SIZE) +
+         (palette_num == 1 ? 0 : row * FC_PAL4_PALETTE_SIZE);
+}
+
+const uint8_t *RowIndices(const uint8_t *packed, int accum_depth, int row)
+{
+  const int palette_num = PackedU16(packed + 2);
+  return packed + FC_PAL4_HEADER_SIZE + palette_num * FC_PAL4_PALETTE_SIZE +
+         row * ((accum_depth + 1) / 2);
+}
+
+void *Init(TfLiteContext *context, const char *buffer, size_t length)
+{
+  (void)buffer;
+  (void)length;
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpDataFcPal4));
+}
+
+/*Palettized rows are summed from the palette, the filter is not decoded here*/
+TfLiteStatus FoldPackedInputOffset(int32_t input_offset, const uint8_t *packed,
+                                   const int32_t *bias, int output_depth, int accum_depth,
+                                   int32_t *folded_bias)
+{
+  const int palette_num = PackedU16(packed + 2);
+  if (PackedU16(packed) != FC_PAL4_MAGIC ||
+      (palette_num != 1 && palette_num != output_depth)) {
+    MicroPrintf("FC_PAL4: filter not packed by pack_pal4.py");
+    return kTfLiteError;
+  }
+
+  for (int out_c = 0; out_c < output_depth; ++out_c) {
+    const int8_t *palette = RowPalette(packed, out_c);
+    const uint8_t *index = RowIndices(packed, accum_depth, out_c);
+    int32_t filter_sum = 0;
+    for (int d = 0; d < accum_depth; ++d) {
+      const uint8_t nibble = (d & 1) ? (index[d >> 1] >> 4) : (index[d >> 1] & 0x0F);
+      filter_sum += palette[nibble];
+    }
+    folded_bias[out_c] = (bias != nullptr ? bias[out_c] : 0) + input_offset * filter_sum;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus Prepare(TfLiteContext *context, TfLiteNode *node)
+{
+  MicroContext *micro_context = GetMicroContext(context);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  TFLITE_DCHECK(node->builtin_data != nullptr);
+  auto *data = static_cast<OpDataFcPal4 *>(node->user_data);
+  const auto *params =
+      static_cast<const TfLiteFullyConnectedParams *>(node->builtin_data);
+
+  TfLiteTensor *input =
+      micro_context->AllocateTempInputTensor(node, kFullyConnectedInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor *filter =
+      micro_context->AllocateTempInputTensor(node, kFullyConnectedWeightsTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  TfLiteTensor *bias =
+      micro_context->AllocateTempInputTensor(node, kFullyConnectedBiasTensor);
+  TfLiteTensor *output =
+      micro_context->AllocateTempOutputTensor(node, kFullyConnectedOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE(context, filter->type == kTfLiteInt8 || filter->type == kTfLiteInt4);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  if (bias != nullptr) {
+    TF_LITE_ENSURE_TYPES_EQ(context, bias->type, kTfLiteInt32);
+    TF_LITE_ENSURE(context, IsConstantTensor(bias));
+  }
+  /*Folding needs constant symmetric weights, palette entries are int8 codes
+    of the original filter quantization*/
+  TF_LITE_ENSURE(context, IsConstantTensor(filter));
+  TF_LITE_ENSURE_EQ(context, filter->params.zero_point, 0);
+
+  TF_LITE_ENSURE_STATUS(CalculateOpDataFullyConnected(
+      context, params->activation, input->type, input, filter, bias, output,
+      &data->base));
+
+  const RuntimeShape filter_shape = GetTensorShape(filter);
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int output_depth = filter_shape.Dims(filter_dim_count - 2);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  data->folded_bias = static_cast<int32_t *>(context->AllocatePersistentBuffer(
+      context, output_depth * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->folded_bias != nullptr);
+  const int32_t *bias_data = bias != nullptr ? GetTensorData<int32_t>(bias) : nullptr;
+
+  data->scratch_index = -1;
+  data->tile_rows = output_depth;
+  if (filter->type == kTfLiteInt8) {
+    fc_int8_m0::FoldInputOffset(-input->params.zero_point, GetTensorData<int8_t>(filter),
+                                bias_data, output_depth, accum_depth, data->folded_bias);
+  } else {
+    TF_LITE_ENSURE_STATUS(FoldPackedInputOffset(
+        -input->params.zero_point, GetTensorData<uint8_t>(filter), bias_data, output_depth,
+        accum_depth, data->folded_bias));
+
+    int tile_rows = FC_PAL4_TILE_BYTES / accum_depth;
+    tile_rows = tile_rows < 1 ? 1 : (tile_rows > output_depth ? output_depth : tile_rows);
+    data->tile_rows = tile_rows;
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, tile_rows * accum_depth, &data->scratch_index));
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  if (bias != nullptr) {
+    micro_context->DeallocateTempTfLiteTensor(bias);
+  }
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext *context, TfLiteNode *node)
+{
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const auto &data = *static_cast<const OpDataFcPal4 *>(node->user_data);
+
+  const TfLiteEvalTensor *input =
+      micro::GetEvalInput(context, node, kFullyConnectedInputTensor);
+  const TfLiteEvalTensor *filter =
+      micro::GetEvalInput(context, node, kFullyConnectedWeightsTensor);
+  TfLiteEvalTensor *output =
+      micro::GetEvalOutput(context, node, kFullyConnectedOutputTensor);
+
+  const RuntimeShape filter_shape = micro::GetTensorShape(filter);
+  const RuntimeShape output_shape = micro::GetTensorShape(output);
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth = output_shape.Dims(output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+  const FullyConnectedParams op_params = FullyConnectedParamsQuantized(data.base);
+  const int8_t *input_data = micro::GetTensorData<int8_t>(input);
+  int8_t *output_data = micro::GetTensorData<int8_t>(output);
+
+  if (data.scratch_index < 0) {
+    fc_int8_m0::FullyConnected(op_params, data.folded_bias, batches, output_depth,
+                               accum_depth, input_data,
+                               micro::GetTensorData<int8_t>(filter), output_data);
+    return kTfLiteOk;
+  }
+
+  /*Tiles outer, batches inner: each row is decoded once per Invoke*/
+  const uint8_t *packed = micro::GetTensorData<uint8_t>(filter);
+  int8_t *tile = static_cast<int8_t *>(context->GetScratchBuffer(context, data.scratch_index));
+  TF_LITE_ENSURE(context, tile != nullptr);
+  for (int row = 0; row < output_depth; row += data.tile_rows) {
+    const int row_num = (output_depth - row) < data.tile_rows ? (output_depth - row)
+                                                              : data.tile_rows;
+    fc_pal4_m0::DecodeRows(packed, accum_depth, row, row_num, tile);
+    for (int b = 0; b < batches; ++b) {
+      fc_int8_m0::FullyConnected(op_params, data.folded_bias + row, 1, row_num, accum_depth,
+                                 input_data + b * accum_depth, tile,
+                                 output_data + b * output_depth + row);
+    }
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+namespace fc_pal4_m0 {
+
+void DecodeRows(const uint8_t *packed, int accum_depth, int first_row, int row_num,
+                int8_t *rows)
+{
+  for (int row = first_row; row < first_row + row_num; ++row) {
+    const int8_t *palette = RowPalette(packed, row);
+    const uint8_t *index = RowIndices(packed, accum_depth, row);
+    int d = accum_depth;
+
+    /*Two weights per byte, one LDRB and two LDRSB from the palette*/
+    for (; d >= 2; d -= 2) {
+      const uint8_t pair = *index++;
+      rows[0] = palette[pair & 0x0F];
+      rows[1] = palette[pair >> 4];
+      rows += 2;
+    }
+    if (d > 0) {
+      *rows++ = palette[*index & 0x0F];
+    }
+  }
+}
+
+}  // namespace fc_pal4_m0
+
+TFLMRegistration Register_FULLY_CONNECTED_PAL4_M0()
+{
+  return micro::RegisterOp(Init, Prepare, Eval);
+}
+
+}  // namespace tflite
@@ -0,0 +1,42 @@
+#ifndef __FC_PAL4_M0_H__
+#define __FC_PAL4_M0_H__
+
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+/* ============================================  Define  ============================================ */
+/* Packed filter buffer written by Tools/pack_pal4.py, tensor type INT4:
+   u16 magic, u16 palette count (1 or output depth), 16 int8 entries per
+   palette, then one row per output channel of (accum_depth + 1) / 2 bytes,
+   low nibble first */
+#define FC_PAL4_MAGIC           (0x3450U)   /* "P4" */
+#define FC_PAL4_HEADER_SIZE     (4)
+#define FC_PAL4_PALETTE_SIZE    (16)
+
+/* Arena scratch for decoded weight rows, one row is decoded even if larger */
+#ifndef FC_PAL4_TILE_BYTES
+#define FC_PAL4_TILE_BYTES      (256)
+#endif
+
+/* ====================================  Functions declaration  ===================================== */
+namespace tflite {
+
+/* FullyConnected for Cortex-M0 with 4-bit palettized weights: each tile of
+   rows is decoded into an arena scratch buffer and run by the fc_int8_m0 inner
+   loop. int8 filters run fc_int8_m0 directly, so one registration serves a
+   model where only the large layers are packed. Register with
+   MicroMutableOpResolver::AddFullyConnected(Register_FULLY_CONNECTED_PAL4_M0()) */
+TFLMRegistration Register_FULLY_CONNECTED_PAL4_M0();
+
+namespace fc_pal4_m0 {
+
+/*Decode rows [first_row, first_row + row_num) of a packed filter to int8*/
+void DecodeRows(const uint8_t *packed, int accum_depth, int first_row, int row_num,
+                int8_t *rows);
+
+}  // namespace fc_pal4_m0
+}  // namespace tflite
+
+#endif
@@ -2,231 +2,231 @@
 
 #include "hello_world_int8_model_data.h"
 
-// unsigned char g_hello_world_int8_model_data[] = {0x28,0x0,0x0,0x0,0x54,0x46,0x4c,0x33,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0xc,0x0,0x10,0x0,0x14,0x0,0x0,0x0,0x18,0x0,0x1c,0x0,0x14,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x3c,0xa,0x0,0x0,0xf0,0x3,0x0,0x0,0xd8,0x3,0x0,0x0,0xe0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0xa,0x0,0x10,0x0,0x4,0x0,0x8,0x0,0xc,0x0,0xa,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x73,0x65,0x72,0x76,0x69,0x6e,0x67,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x0,0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x98,0xff,0xff,0xff,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x64,0x65,0x6e,0x73,0x65,0x5f,0x32,0x0,0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xba,0xfc,0xff,0xff,0x4,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x64,0x65,0x6e,0x73,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0,0x2,0x0,0x0,0x0,0x34,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xdc,0xff,0xff,0xff,0x8,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x43,0x4f,0x4e,0x56,0x45,0x52,0x53,0x49,0x4f,0x4e,0x5f,0x4d,0x45,0x54,0x41,0x44,0x41,0x54,0x41,0x0,0x8,0x0,0xc,0x0,0x4,0x0,0x8,0x0,0x8,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x6d,0x69,0x6e,0x5f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x0,0xd,0x0,0x0,0x0,0xec,0x2,0x0,0x0,0xe4,0x2,0x0,0x0,0xcc,0x2,0x0,0x0,0x98,0x2,0x0,0x0,0x44,0x2,0x0,0x0,0x30,0x1,0x0,0x0,0xdc,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,0xb0,0x0,0x0,0x0,0xa8,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x66,0xfd,0xff,0xff,0x4,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x8,0x0,0xe,0x0,0x8,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x8,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xeb,0x3,0x0,0x0,0x0,0x0,0xa,0x0,0x10,0x0,0xc,0x0,0x8,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x32,0x2e,0x31,0x31,0x2e,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd6,0xfd,0xff,0xff,0x4,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x31,0x2e,0x31,0x34,0x2e,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x64,0xfd,0xff,0xff,0x68,0xfd,0xff,0xff,0x6c,0xfd,0xff,0xff,0x6,0xfe,0xff,0xff,0x4,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xf7,0xca,0x39,0x47,0x68,0x73,0x62,0x63,0x40,0xe6,0x7f,0x19,0xae,0x44,0x5f,0x56,0x0,0x0,0x0,0x0,0x26,0xfe,0xff,0xff,0x4,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc2,0xea,0xff,0xff,0x75,0xea,0xff,0xff,0xb8,0xfa,0xff,0xff,0x24,0xfa,0xff,0xff,0xc8,0xef,0xff,0xff,0xac,0xff,0xff,0xff,0x44,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0xbd,0x7,0x0,0x0,0x33,0xea,0xff,0xff,0x0,0x0,0x0,0x0,0xcc,0xe4,0xff,0xff,0x4f,0xd,0x0,0x0,0xcf,0xe3,0xff,0xff,0x0,0x0,0x0,0x0,0x76,0xfe,0xff,0xff,0x4,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0xf4,0x1a,0xed,0x9,0x19,0x21,0xf4,0x24,0xe0,0x21,0xef,0xbc,0xf7,0xf5,0xfa,0x19,0x3,0xdc,0xd2,0x2,0x6,0xf9,0xf4,0x2,0xff,0xfa,0xef,0xf1,0xef,0xd3,0x27,0xe1,0xfb,0x27,0xdd,0xeb,0xdb,0xe4,0x5,0x1a,0x17,0xfc,0x24,0x12,0x15,0xef,0x1e,0xe4,0x10,0xfe,0x14,0xda,0x1c,0xf8,0xf3,0xf1,0xef,0xe2,0xf3,0x9,0xe3,0xe9,0xed,0xe3,0xe4,0x15,0x7,0xb,0x4,0x1b,0x1a,0xfe,0xeb,0x1,0xde,0x21,0xe6,0xb,0xec,0x3,0x23,0xa,0x22,0x24,0x1e,0x27,0x3,0xe6,0x3,0x24,0xff,0xc0,0x11,0xf8,0xfc,0xf1,0x11,0xc,0xf5,0xe0,0xf3,0x7,0x17,0xe5,0xe8,0xed,0xfa,0xdc,0xe8,0x23,0xfb,0x7,0xdd,0xfb,0xfd,0x0,0x14,0x26,0x11,0x17,0xe7,0xf1,0x11,0xea,0x2,0x26,0x4,0x4,0x25,0x21,0x1d,0xa,0xdb,0x1d,0xdc,0x20,0x1,0xfa,0xe3,0x37,0xb,0xf1,0x1a,0x16,0xef,0x1c,0xe7,0x3,0xe0,0x16,0x2,0x3,0x21,0x18,0x9,0x2e,0xd9,0xe5,0x14,0xb,0xea,0x1a,0xfc,0xd8,0x13,0x0,0xc4,0xd8,0xec,0xd9,0xfe,0xd,0x19,0x20,0xd8,0xd6,0xe2,0x1f,0xe9,0xd7,0xca,0xe2,0xdd,0xc6,0x13,0xe7,0x4,0x3e,0x0,0x1,0x14,0xc7,0xdb,0xe7,0x15,0x15,0xf5,0x6,0xd6,0x1a,0xdc,0x9,0x22,0xfe,0x8,0x2,0x13,0xef,0x19,0x1e,0xe2,0x9,0xfd,0xf3,0x14,0xdd,0xda,0x20,0xd9,0xf,0xe3,0xf9,0xf7,0xee,0xe9,0x24,0xe6,0x29,0x0,0x7,0x16,0xe2,0x1e,0xd,0x23,0xd3,0xdd,0xf7,0x14,0xfa,0x8,0x22,0x26,0x21,0x9,0x8,0xf,0xb,0xe0,0x12,0xf4,0x7f,0xdc,0x58,0xe5,0x26,0x0,0x0,0x0,0x0,0x86,0xff,0xff,0xff,0x4,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x27,0xfd,0xff,0xff,0xa2,0x7,0x0,0x0,0x62,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0x29,0xfe,0xff,0xff,0xdd,0xff,0xff,0xff,0x9d,0xfc,0xff,0xff,0x3b,0x2,0x0,0x0,0x45,0x2,0x0,0x0,0xa4,0x10,0x0,0x0,0x67,0xf,0x0,0x0,0x4f,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x87,0xfc,0xff,0xff,0x11,0xec,0xff,0xff,0x0,0x0,0x0,0x0,0xd6,0xff,0xff,0xff,0x4,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xd9,0x3b,0x27,0x15,0x1c,0xe0,0xde,0xdd,0xf,0x1b,0xc5,0xd7,0x12,0xdd,0xf9,0x7f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x8,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xad,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0xff,0xff,0xff,0x88,0xff,0xff,0xff,0xf,0x0,0x0,0x0,0x4d,0x4c,0x49,0x52,0x20,0x43,0x6f,0x6e,0x76,0x65,0x72,0x74,0x65,0x64,0x2e,0x0,0x1,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x18,0x0,0x4,0x0,0x8,0x0,0xc,0x0,0x10,0x0,0x14,0x0,0xe,0x0,0x0,0x0,0x4,0x1,0x0,0x0,0xf8,0x0,0x0,0x0,0xec,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xca,0xff,0xff,0xff,0x0,0x0,0x0,0x8,0x1c,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x4,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x14,0x0,0x0,0x0,0x8,0x0,0xc,0x0,0x7,0x0,0x10,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x1c,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xba,0xff,0xff,0xff,0x0,0x0,0x0,0x1,0x1,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x16,0x0,0x0,0x0,0x8,0x0,0xc,0x0,0x7,0x0,0x10,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x24,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x8,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x9c,0x4,0x0,0x0,0xc,0x4,0x0,0x0,0x88,0x3,0x0,0x0,0x14,0x3,0x0,0x0,0xa8,0x2,0x0,0x0,0x34,0x2,0x0,0x0,0xd0,0x1,0x0,0x0,0x2c,0x1,0x0,0x0,0x80,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xa2,0xfb,0xff,0xff,0x0,0x0,0x9,0x1,0x64,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xff,0xff,0xff,0xff,0x1,0x0,0x0,0x0,0x8c,0xfb,0xff,0xff,0x18,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xcb,0xd6,0x7,0x3c,0x19,0x0,0x0,0x0,0x53,0x74,0x61,0x74,0x65,0x66,0x75,0x6c,0x50,0x61,0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x65,0x64,0x43,0x61,0x6c,0x6c,0x3a,0x30,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1a,0xfc,0xff,0xff,0x0,0x0,0x9,0x1,0x94,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xff,0xff,0xff,0xff,0x10,0x0,0x0,0x0,0x4,0xfc,0xff,0xff,0x14,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1,0x0,0x0,0x0,0x5d,0x4f,0x51,0x3c,0x4c,0x0,0x0,0x0,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31,0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31,0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xc2,0xfc,0xff,0xff,0x0,0x0,0x9,0x1,0x8c,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xff,0xff,0xff,0xff,0x10,0x0,0x0,0x0,0xac,0xfc,0xff,0xff,0x14,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1,0x0,0x0,0x0,0x9f,0x51,0x5a,0x3c,0x46,0x0,0x0,0x0,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64,0x0,0x0,0x2,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xee,0xfd,0xff,0xff,0x0,0x0,0x9,0x1,0x4c,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x3c,0xfd,0xff,0xff,0x14,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xaa,0x59,0x84,0x3b,0x17,0x0,0x0,0x0,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x0,0x2,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x4e,0xfe,0xff,0xff,0x0,0x0,0x2,0x1,0x60,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x9c,0xfd,0xff,0xff,0x18,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x55,0x5b,0xcf,0x38,0x27,0x0,0x0,0x0,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64,0x2f,0x52,0x65,0x61,0x64,0x56,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x4f,0x70,0x0,0x1,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xbe,0xfe,0xff,0xff,0x0,0x0,0x9,0x1,0x54,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xc,0xfe,0xff,0xff,0x18,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x7f,0x7f,0x32,0x3c,0x19,0x0,0x0,0x0,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31,0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x26,0xff,0xff,0xff,0x0,0x0,0x2,0x1,0x60,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x74,0xfe,0xff,0xff,0x14,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x7b,0x39,0x18,0x39,0x29,0x0,0x0,0x0,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31,0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64,0x2f,0x52,0x65,0x61,0x64,0x56,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x4f,0x70,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x96,0xff,0xff,0xff,0x0,0x0,0x9,0x1,0x54,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0xe4,0xfe,0xff,0xff,0x18,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x17,0x44,0x7c,0x3c,0x19,0x0,0x0,0x0,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x32,0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x18,0x0,0x8,0x0,0x6,0x0,0xc,0x0,0x10,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x2,0x1,0x64,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x64,0xff,0xff,0xff,0x18,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xcb,0x41,0x4e,0x39,0x29,0x0,0x0,0x0,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x32,0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64,0x2f,0x52,0x65,0x61,0x64,0x56,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x4f,0x70,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x1c,0x0,0x8,0x0,0x6,0x0,0xc,0x0,0x10,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x7,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x9,0x1,0x74,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xff,0xff,0xff,0xff,0x1,0x0,0x0,0x0,0xc,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x8,0x0,0xc,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x86,0x8a,0xc8,0x3c,0x1d,0x0,0x0,0x0,0x73,0x65,0x72,0x76,0x69,0x6e,0x67,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x3a,0x30,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xc,0x0,0x10,0x0,0x7,0x0,0x0,0x0,0x8,0x0,0xc,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x4,0x0,0x0,0x0,0x9,0x0,0x0,0x0};
-unsigned char g_hello_world_int8_model_data[] = {
-  0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x12, 0x00,
-  0x1c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
-  0x00, 0x00, 0x18, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x3c, 0x0a, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xe8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x54, 0x4f, 0x43, 0x4f, 0x20, 0x43, 0x6f, 0x6e,
-  0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x84, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+const unsigned char g_hello_world_int8_model_data[] TFLM_MODEL_DATA_ATTR = {
+  0x28, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x3c, 0x0a, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73,
+  0x65, 0x5f, 0x32, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xba, 0xfc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xdc, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49,
+  0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xec, 0x02, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x66, 0xfd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x32, 0x2e, 0x31, 0x31, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xfd, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
+  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xfd, 0xff, 0xff,
+  0x68, 0xfd, 0xff, 0xff, 0x6c, 0xfd, 0xff, 0xff, 0x06, 0xfe, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf7, 0xca, 0x39, 0x47,
+  0x68, 0x73, 0x62, 0x63, 0x40, 0xe6, 0x7f, 0x19, 0xae, 0x44, 0x5f, 0x56,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc2, 0xea, 0xff, 0xff, 0x75, 0xea, 0xff, 0xff, 0xb8, 0xfa, 0xff, 0xff,
+  0x24, 0xfa, 0xff, 0xff, 0xc8, 0xef, 0xff, 0xff, 0xac, 0xff, 0xff, 0xff,
+  0x44, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x07, 0x00, 0x00,
+  0x33, 0xea, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xe4, 0xff, 0xff,
+  0x4f, 0x0d, 0x00, 0x00, 0xcf, 0xe3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xf4, 0x1a, 0xed, 0x09, 0x19, 0x21, 0xf4, 0x24, 0xe0, 0x21, 0xef, 0xbc,
+  0xf7, 0xf5, 0xfa, 0x19, 0x03, 0xdc, 0xd2, 0x02, 0x06, 0xf9, 0xf4, 0x02,
+  0xff, 0xfa, 0xef, 0xf1, 0xef, 0xd3, 0x27, 0xe1, 0xfb, 0x27, 0xdd, 0xeb,
+  0xdb, 0xe4, 0x05, 0x1a, 0x17, 0xfc, 0x24, 0x12, 0x15, 0xef, 0x1e, 0xe4,
+  0x10, 0xfe, 0x14, 0xda, 0x1c, 0xf8, 0xf3, 0xf1, 0xef, 0xe2, 0xf3, 0x09,
+  0xe3, 0xe9, 0xed, 0xe3, 0xe4, 0x15, 0x07, 0x0b, 0x04, 0x1b, 0x1a, 0xfe,
+  0xeb, 0x01, 0xde, 0x21, 0xe6, 0x0b, 0xec, 0x03, 0x23, 0x0a, 0x22, 0x24,
+  0x1e, 0x27, 0x03, 0xe6, 0x03, 0x24, 0xff, 0xc0, 0x11, 0xf8, 0xfc, 0xf1,
+  0x11, 0x0c, 0xf5, 0xe0, 0xf3, 0x07, 0x17, 0xe5, 0xe8, 0xed, 0xfa, 0xdc,
+  0xe8, 0x23, 0xfb, 0x07, 0xdd, 0xfb, 0xfd, 0x00, 0x14, 0x26, 0x11, 0x17,
+  0xe7, 0xf1, 0x11, 0xea, 0x02, 0x26, 0x04, 0x04, 0x25, 0x21, 0x1d, 0x0a,
+  0xdb, 0x1d, 0xdc, 0x20, 0x01, 0xfa, 0xe3, 0x37, 0x0b, 0xf1, 0x1a, 0x16,
+  0xef, 0x1c, 0xe7, 0x03, 0xe0, 0x16, 0x02, 0x03, 0x21, 0x18, 0x09, 0x2e,
+  0xd9, 0xe5, 0x14, 0x0b, 0xea, 0x1a, 0xfc, 0xd8, 0x13, 0x00, 0xc4, 0xd8,
+  0xec, 0xd9, 0xfe, 0x0d, 0x19, 0x20, 0xd8, 0xd6, 0xe2, 0x1f, 0xe9, 0xd7,
+  0xca, 0xe2, 0xdd, 0xc6, 0x13, 0xe7, 0x04, 0x3e, 0x00, 0x01, 0x14, 0xc7,
+  0xdb, 0xe7, 0x15, 0x15, 0xf5, 0x06, 0xd6, 0x1a, 0xdc, 0x09, 0x22, 0xfe,
+  0x08, 0x02, 0x13, 0xef, 0x19, 0x1e, 0xe2, 0x09, 0xfd, 0xf3, 0x14, 0xdd,
+  0xda, 0x20, 0xd9, 0x0f, 0xe3, 0xf9, 0xf7, 0xee, 0xe9, 0x24, 0xe6, 0x29,
+  0x00, 0x07, 0x16, 0xe2, 0x1e, 0x0d, 0x23, 0xd3, 0xdd, 0xf7, 0x14, 0xfa,
+  0x08, 0x22, 0x26, 0x21, 0x09, 0x08, 0x0f, 0x0b, 0xe0, 0x12, 0xf4, 0x7f,
+  0xdc, 0x58, 0xe5, 0x26, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x27, 0xfd, 0xff, 0xff,
+  0xa2, 0x07, 0x00, 0x00, 0x62, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0x29, 0xfe, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff,
+  0x9d, 0xfc, 0xff, 0xff, 0x3b, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00,
+  0xa4, 0x10, 0x00, 0x00, 0x67, 0x0f, 0x00, 0x00, 0x4f, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x87, 0xfc, 0xff, 0xff, 0x11, 0xec, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xd9, 0x3b, 0x27, 0x15, 0x1c, 0xe0, 0xde, 0xdd,
+  0x0f, 0x1b, 0xc5, 0xd7, 0x12, 0xdd, 0xf9, 0x7f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xad, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x84, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x07, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
   0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xbe, 0xff, 0xff, 0xff, 0x54, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff,
-  0x1c, 0x01, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0x78, 0x01, 0x00, 0x00,
-  0xd6, 0xff, 0xff, 0xff, 0xf8, 0x01, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff,
-  0x78, 0x02, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0x10, 0x03, 0x00, 0x00,
-  0xf4, 0xf6, 0xff, 0xff, 0xf8, 0xf6, 0xff, 0xff, 0x04, 0x00, 0x06, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x14, 0xf7, 0xff, 0xff,
-  0x18, 0xf7, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x35, 0x2e,
-  0x30, 0x00, 0x00, 0x00, 0x90, 0xf7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
-  0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
-  0x0c, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x54, 0x08, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
-  0xe4, 0x07, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00,
-  0x28, 0x03, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
-  0xdc, 0x02, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x4e, 0xf8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x69,
-  0x61, 0x73, 0x00, 0x00, 0xe8, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xc7, 0x60, 0x9b, 0xbe, 0x9a, 0xf8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x2f, 0x4d,
-  0x61, 0x74, 0x4d, 0x75, 0x6c, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x2f, 0x74, 0x72, 0x61,
-  0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x4c, 0xf8, 0xff, 0xff,
-  0x40, 0x00, 0x00, 0x00, 0xf6, 0xe8, 0x46, 0x3e, 0xbd, 0x2a, 0x00, 0x3f,
-  0x35, 0xa3, 0x61, 0x3e, 0xae, 0xb9, 0xa6, 0x3f, 0xd3, 0x81, 0x78, 0xbf,
-  0x7d, 0xe2, 0xfc, 0xbe, 0x7f, 0xd3, 0x2d, 0xbf, 0xc5, 0x82, 0x8c, 0xbf,
-  0x2c, 0x95, 0xd4, 0x3e, 0x9a, 0x17, 0x04, 0x3f, 0x26, 0xc3, 0xfc, 0x3e,
-  0xfa, 0x61, 0xa6, 0x3e, 0x48, 0xd4, 0x06, 0xbe, 0xea, 0x72, 0x9b, 0x3e,
-  0xc2, 0xee, 0x36, 0x3f, 0xee, 0xdf, 0x10, 0xbf, 0x3a, 0xf9, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0xba, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00,
+  0x0c, 0x04, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00,
+  0xa8, 0x02, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00,
+  0x2c, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xa2, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x09, 0x01, 0x64, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x8c, 0xfb, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xcb, 0xd6, 0x07, 0x3c, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1a, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x09, 0x01, 0x94, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x5d, 0x4f, 0x51, 0x3c,
+  0x4c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
   0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x4d,
-  0x61, 0x74, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00,
-  0xd4, 0xf8, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0xd5, 0xcc, 0x2e, 0xbd,
-  0xda, 0x4f, 0xca, 0xbe, 0xf8, 0xe6, 0xc1, 0xbd, 0xaf, 0x91, 0xff, 0x3e,
-  0x2f, 0x20, 0xc5, 0x3d, 0x20, 0xae, 0x80, 0x3e, 0xab, 0x8c, 0xb4, 0x3e,
-  0xc2, 0x45, 0xf9, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x43, 0x97, 0x8e, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2f, 0xf8, 0x8f, 0xbd, 0x53, 0x5f, 0x27, 0xbe, 0x07, 0xd8, 0xe1, 0x3e,
-  0xc2, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x69, 0x61, 0x73,
-  0x00, 0x00, 0x00, 0x00, 0x5c, 0xf9, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xe1, 0x44, 0x19, 0x3f, 0x01, 0x63, 0xa7, 0x3e,
-  0xc0, 0xe8, 0x64, 0x3d, 0x08, 0xb5, 0x8c, 0x3e, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xcc, 0xab, 0x57, 0x3d, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x38, 0x47, 0xbf, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf2, 0x8d, 0x12, 0xbe, 0x97, 0x32, 0x6e, 0x3f,
-  0x00, 0x00, 0x00, 0x00, 0x4a, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74,
-  0x4d, 0x75, 0x6c, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x2f, 0x74, 0x72, 0x61, 0x6e, 0x73,
-  0x70, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xf9, 0xff, 0xff,
-  0x40, 0x00, 0x00, 0x00, 0xe0, 0xdc, 0x86, 0xbc, 0x0e, 0xfb, 0xa4, 0xbd,
-  0x54, 0x9a, 0x81, 0x3e, 0x29, 0x57, 0x0b, 0x3f, 0xf6, 0x4b, 0x6d, 0x3e,
-  0xaf, 0x91, 0x0e, 0xbf, 0x88, 0xb3, 0x46, 0xbe, 0x7a, 0xcb, 0x70, 0x3e,
-  0xe0, 0xae, 0x48, 0xbd, 0xb8, 0xc3, 0x12, 0xbf, 0xdb, 0xf1, 0x8e, 0x3e,
-  0x40, 0x6d, 0x6e, 0xbd, 0x27, 0xf6, 0x8a, 0xbe, 0xe8, 0xcc, 0xbd, 0x3e,
-  0x86, 0xdd, 0x42, 0xbe, 0x80, 0x80, 0xfd, 0xbc, 0xea, 0xfa, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x49, 0x64, 0x65, 0x6e,
-  0x74, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00, 0x74, 0xfa, 0xff, 0xff,
-  0x1e, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x00,
-  0xb4, 0xfa, 0xff, 0xff, 0x5e, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31,
+  0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31,
+  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00,
   0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0xc2, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x09, 0x01, 0x8c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0xac, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x9f, 0x51, 0x5a, 0x3c,
+  0x46, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74,
+  0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
   0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x52, 0x65, 0x6c,
-  0x75, 0x00, 0x00, 0x00, 0xf4, 0xfa, 0xff, 0xff, 0x9e, 0xfb, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
+  0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
+  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xee, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x09, 0x01,
+  0x4c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3c, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x59, 0x84, 0x3b,
+  0x17, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74,
+  0x4d, 0x75, 0x6c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x4e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x02, 0x01,
+  0x60, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x9c, 0xfd, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x55, 0x5b, 0xcf, 0x38, 0x27, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
   0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x2f, 0x52, 0x65,
-  0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70,
-  0x2f, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x00, 0x00,
-  0x50, 0xfb, 0xff, 0xff, 0x00, 0x04, 0x00, 0x00, 0x86, 0x60, 0x31, 0x3e,
-  0xbb, 0xde, 0x41, 0xbc, 0x02, 0xd7, 0xc3, 0xbe, 0xe0, 0xc8, 0x5a, 0xbc,
-  0xcd, 0x33, 0x99, 0xbe, 0x8c, 0xf2, 0xb4, 0x3d, 0xc8, 0x16, 0x4d, 0xbd,
-  0x5e, 0x63, 0xe0, 0x3d, 0xc2, 0xa7, 0x17, 0x3e, 0x5a, 0xea, 0x79, 0x3e,
-  0x20, 0xfb, 0x05, 0xbe, 0xbc, 0xc2, 0xa1, 0x3d, 0x22, 0xa1, 0x29, 0x3e,
-  0xfd, 0x3b, 0xb5, 0xbe, 0x78, 0x89, 0x61, 0x3e, 0x14, 0x53, 0xad, 0x3d,
-  0xfe, 0x6f, 0x57, 0x3e, 0x84, 0x4e, 0x47, 0xbf, 0xa3, 0x4a, 0x2c, 0xbe,
-  0x0e, 0xd9, 0x71, 0x3e, 0xd5, 0x12, 0x2e, 0xbd, 0x72, 0xec, 0x88, 0xbe,
-  0x13, 0x72, 0x92, 0x3e, 0xc1, 0x30, 0x1b, 0x3e, 0xab, 0x3d, 0xdd, 0xbe,
-  0x2e, 0x88, 0x19, 0xbe, 0xad, 0x51, 0x12, 0x3f, 0x40, 0x74, 0xe6, 0x3b,
-  0xda, 0xcf, 0x9f, 0xbe, 0x76, 0x51, 0x00, 0x3f, 0x27, 0xef, 0x6a, 0x3f,
-  0x60, 0xe4, 0x14, 0xbd, 0x2f, 0x1f, 0xb7, 0x3e, 0xb8, 0x05, 0x84, 0xbe,
-  0xdf, 0x3d, 0xfb, 0x3d, 0x54, 0xfa, 0x8d, 0xbe, 0x87, 0x71, 0x11, 0xbd,
-  0x4b, 0x4a, 0xbc, 0x3e, 0x56, 0x7e, 0xc3, 0xbe, 0x33, 0xcc, 0x0c, 0xbe,
-  0x17, 0x10, 0xcd, 0x3e, 0xd8, 0x62, 0x98, 0xbe, 0x00, 0x55, 0xa0, 0xbd,
-  0x08, 0x22, 0x41, 0x3d, 0xe7, 0xc2, 0x9a, 0x3e, 0x11, 0x20, 0xfc, 0xbe,
-  0x87, 0x07, 0x50, 0x3e, 0x77, 0xad, 0xda, 0xbe, 0x00, 0xda, 0x70, 0xbc,
-  0xf9, 0xb0, 0x4f, 0x3d, 0xcc, 0x8a, 0xfb, 0xbb, 0xe8, 0x04, 0xce, 0xbe,
-  0x6e, 0xc7, 0x58, 0x3e, 0x66, 0x0b, 0xbe, 0xbe, 0x8e, 0xed, 0xd3, 0xbe,
-  0x52, 0x2c, 0xa1, 0x3e, 0x0c, 0x64, 0xf0, 0x3d, 0xe0, 0x7b, 0xa4, 0xbc,
-  0x30, 0x7b, 0x9c, 0xbf, 0xb6, 0x62, 0x66, 0x3e, 0xe0, 0xad, 0x87, 0xbc,
-  0xa6, 0xc8, 0xfb, 0x3d, 0x07, 0x65, 0x8f, 0x3f, 0x28, 0xe1, 0x1e, 0xbe,
-  0x85, 0x35, 0xcb, 0x3e, 0x34, 0xdf, 0x81, 0x3e, 0x26, 0x29, 0x7f, 0xbe,
-  0xe4, 0x05, 0x9b, 0xbe, 0x7a, 0xe4, 0x2d, 0x3e, 0x2b, 0x5b, 0xd6, 0x3e,
-  0xc6, 0x83, 0x0f, 0x3e, 0x19, 0x7a, 0x03, 0xbf, 0x06, 0x39, 0x13, 0x3e,
-  0xe3, 0x7b, 0xac, 0xbe, 0xc0, 0x56, 0x7a, 0x3c, 0xc0, 0x95, 0x0d, 0x3d,
-  0xea, 0x2f, 0x21, 0xbe, 0x61, 0x0b, 0x75, 0xbf, 0x40, 0x40, 0xe1, 0x3d,
-  0x8c, 0xf7, 0xbd, 0xbe, 0xe6, 0x09, 0x4a, 0x3e, 0x26, 0xdd, 0x7f, 0x3f,
-  0xaf, 0x69, 0x36, 0x3d, 0x96, 0x8f, 0x90, 0x3e, 0x5c, 0xa5, 0x06, 0x3e,
-  0xe4, 0xfb, 0x84, 0x3d, 0x75, 0x75, 0x80, 0x3e, 0xa5, 0x6d, 0x0c, 0x3d,
-  0xec, 0x93, 0xe1, 0xbd, 0x8c, 0x3a, 0xaf, 0xbd, 0xa3, 0x88, 0x97, 0xbe,
-  0x17, 0x7d, 0xdd, 0x3e, 0x86, 0x6d, 0x57, 0xbe, 0xd5, 0xb7, 0xa2, 0xbd,
-  0x94, 0xb1, 0x51, 0xbf, 0x09, 0xaf, 0x7c, 0xbe, 0x86, 0x01, 0x40, 0x3e,
-  0xcc, 0x44, 0x6e, 0x3f, 0xaa, 0xe2, 0xc0, 0x3e, 0xfe, 0x1a, 0x9a, 0x3d,
-  0x8c, 0xeb, 0x56, 0xbd, 0x05, 0x2e, 0xb0, 0x3e, 0x4f, 0x40, 0xa7, 0x3e,
-  0x1e, 0x7b, 0x75, 0xbe, 0x27, 0x7b, 0x79, 0xbe, 0xd8, 0x1f, 0x00, 0xbe,
-  0x9c, 0xdf, 0x16, 0xbf, 0x16, 0x8d, 0x12, 0xbe, 0x08, 0xf7, 0x4a, 0xbd,
-  0x2e, 0x7c, 0x26, 0xbd, 0x04, 0xef, 0xf4, 0xbf, 0xf5, 0xda, 0xa9, 0x3e,
-  0xb2, 0xc9, 0x41, 0xbe, 0x55, 0x20, 0x1d, 0x3f, 0x93, 0xc0, 0x69, 0xbf,
-  0xa7, 0xdf, 0x8a, 0xbf, 0x9a, 0x70, 0x67, 0xbd, 0xf2, 0x12, 0xa6, 0xbe,
-  0x2e, 0x20, 0x39, 0x3e, 0xe0, 0x0c, 0x04, 0x3f, 0x6e, 0xf1, 0x61, 0x3e,
-  0xc0, 0x8d, 0x66, 0x3c, 0x78, 0x6a, 0x24, 0x3d, 0xba, 0xfd, 0x7d, 0x3e,
-  0x39, 0x45, 0x41, 0xbe, 0x9c, 0xd5, 0x84, 0x3e, 0xd3, 0xb1, 0x52, 0x3f,
-  0x10, 0xa3, 0xb0, 0x3c, 0x98, 0x8e, 0x4c, 0xbd, 0xba, 0x1d, 0x73, 0x3e,
-  0x0d, 0x64, 0xba, 0xbe, 0xf0, 0x16, 0x84, 0xbd, 0xe3, 0xf0, 0xd6, 0xbe,
-  0x16, 0x1a, 0x09, 0x3e, 0x7e, 0x8b, 0x2c, 0x3e, 0x10, 0xc9, 0x90, 0xbe,
-  0x83, 0xa8, 0xb1, 0x3e, 0xc0, 0xc4, 0x1e, 0x3c, 0x7c, 0xc3, 0x8b, 0xbe,
-  0x09, 0x33, 0x8d, 0x3e, 0xd4, 0xa5, 0x73, 0xbe, 0xcd, 0x1d, 0x5d, 0xbe,
-  0x70, 0x76, 0x7a, 0xbe, 0x7a, 0xa2, 0xa1, 0xbe, 0x30, 0x9a, 0xb5, 0xbd,
-  0xea, 0x21, 0x2f, 0xbe, 0xf0, 0x54, 0x08, 0x3d, 0xc8, 0xfc, 0xf9, 0xbd,
-  0x45, 0x36, 0xa2, 0xbe, 0x2d, 0x63, 0xb6, 0x3e, 0xd8, 0x80, 0x09, 0xbe,
-  0x88, 0x6b, 0x08, 0xbe, 0xe0, 0x0d, 0x85, 0xbe, 0x6e, 0xdd, 0x03, 0x3e,
-  0x98, 0xdd, 0x27, 0xbd, 0xda, 0xd3, 0xab, 0xbe, 0x82, 0x9f, 0x3b, 0x3e,
-  0x4e, 0x49, 0x0a, 0xbe, 0x38, 0x09, 0x56, 0x3d, 0x2b, 0x90, 0xc0, 0xbe,
-  0x5e, 0x40, 0x3e, 0x3e, 0xf6, 0x6d, 0xbb, 0x3b, 0xed, 0xf3, 0xa8, 0xbe,
-  0x00, 0x7f, 0xd3, 0xbb, 0xda, 0x0c, 0xa4, 0xbc, 0x90, 0x53, 0xd0, 0xbc,
-  0x98, 0xad, 0x04, 0xbe, 0xaa, 0xc8, 0x8b, 0xbe, 0x8b, 0xbb, 0xa8, 0x3e,
-  0x3e, 0x1f, 0x0b, 0x3e, 0xe5, 0x9a, 0xc5, 0x3e, 0xcd, 0x0d, 0xc2, 0xbe,
-  0x77, 0x34, 0xd8, 0x3e, 0x05, 0x5a, 0xb2, 0xbe, 0xca, 0x85, 0x39, 0x3e,
-  0x64, 0x63, 0x28, 0xbe, 0xb0, 0x5f, 0xe1, 0xbd, 0x01, 0x5a, 0xa2, 0x3e,
-  0x41, 0x47, 0x61, 0xbe, 0x70, 0x30, 0xaf, 0xbe, 0xbf, 0x2b, 0x3f, 0xbe,
-  0x49, 0xb9, 0xcc, 0xbe, 0x3e, 0x3f, 0x65, 0x3e, 0x6e, 0x51, 0xa8, 0xbe,
-  0xcb, 0x18, 0xa9, 0xbe, 0xb8, 0xc8, 0x46, 0x3d, 0x1e, 0x4c, 0x7d, 0x3e,
-  0x8a, 0x23, 0x53, 0x3e, 0x28, 0xfe, 0xcf, 0xbd, 0xef, 0x45, 0xc5, 0xbe,
-  0xd6, 0xc3, 0xbc, 0xbe, 0x0c, 0xda, 0x2d, 0xbe, 0xdd, 0xba, 0xa6, 0x3e,
-  0x85, 0x3f, 0xb1, 0x3e, 0x06, 0xa6, 0x04, 0x3e, 0x90, 0x76, 0xd8, 0x3c,
-  0x44, 0xf4, 0x9b, 0x3d, 0x8a, 0x49, 0x5f, 0x3e, 0x5a, 0xfb, 0x73, 0x3e,
-  0x9e, 0x08, 0xb5, 0xbe, 0x3d, 0x4a, 0xc5, 0x3e, 0xb7, 0x4d, 0xb1, 0x3e,
-  0x84, 0x54, 0xc3, 0x3d, 0x51, 0x7b, 0xc0, 0x3e, 0x91, 0xfb, 0xa5, 0x3e,
-  0x0d, 0xe8, 0xba, 0xbe, 0x7d, 0x25, 0xb4, 0xbe, 0xc4, 0x7f, 0xa6, 0xbd,
-  0x69, 0x44, 0x68, 0xbe, 0x99, 0x28, 0x77, 0x3d, 0xef, 0xdf, 0xb3, 0xbe,
-  0x00, 0x70, 0xa8, 0x38, 0x42, 0x0d, 0x69, 0x3d, 0xb5, 0x38, 0x98, 0xbe,
-  0x48, 0x9f, 0x1e, 0xbd, 0x6c, 0x55, 0xc6, 0xbd, 0xc9, 0x57, 0xcd, 0x3e,
-  0xd4, 0xf9, 0xe0, 0x3d, 0x9d, 0x13, 0x5b, 0xbe, 0x80, 0x75, 0x82, 0xbb,
-  0x54, 0x13, 0x22, 0xbe, 0x91, 0x1d, 0xb5, 0xbe, 0x6f, 0x17, 0x0e, 0x3e,
-  0x74, 0x82, 0x88, 0xbe, 0x50, 0x06, 0x51, 0x3d, 0xce, 0x24, 0x4d, 0xbf,
-  0x1a, 0x8a, 0x9e, 0xbe, 0x0d, 0x86, 0x8f, 0x3e, 0x9a, 0x04, 0xc2, 0xbc,
-  0x43, 0x82, 0x7a, 0xbe, 0x04, 0xa8, 0x85, 0xbe, 0xc5, 0x55, 0x5f, 0x3d,
-  0x00, 0x73, 0x85, 0xba, 0x49, 0xc0, 0xab, 0xbe, 0xd6, 0x6a, 0x00, 0x3f,
-  0x48, 0x99, 0xf5, 0xbd, 0xa0, 0xc7, 0xac, 0xbe, 0xab, 0xc6, 0x55, 0xbe,
-  0xcf, 0x44, 0x9d, 0xbc, 0x84, 0xf0, 0x97, 0xbe, 0xd0, 0xa3, 0xb8, 0xbe,
-  0xa4, 0x76, 0x75, 0x3f, 0x7d, 0x2e, 0x07, 0xbe, 0xb8, 0x31, 0x90, 0x3e,
-  0x8b, 0x88, 0x0f, 0xbe, 0x26, 0x95, 0x7e, 0x3e, 0x83, 0x1a, 0xab, 0x3e,
-  0x94, 0xda, 0x4e, 0xbd, 0x1d, 0x66, 0x88, 0x3e, 0xbe, 0x09, 0x6e, 0xbe,
-  0xe0, 0xb5, 0x33, 0xbf, 0xc2, 0xaa, 0x32, 0x3e, 0x7e, 0x31, 0x0a, 0xbe,
-  0x0e, 0x2a, 0x53, 0xbc, 0x58, 0x38, 0xed, 0xbf, 0x44, 0xcf, 0xe2, 0x3d,
-  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00,
-  0x0c, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x43, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x8e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xfa, 0xff, 0xff, 0xff, 0x00, 0x09, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09
+  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
+  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbe, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x09, 0x01, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0c, 0xfe, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x32, 0x3c, 0x19, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64,
+  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75,
+  0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x01,
+  0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x74, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7b, 0x39, 0x18, 0x39,
+  0x29, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x42,
+  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
+  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x09, 0x01, 0x54, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe4, 0xfe, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x17, 0x44, 0x7c, 0x3c, 0x19, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64,
+  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75,
+  0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x08, 0x00,
+  0x06, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01,
+  0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xcb, 0x41, 0x4e, 0x39, 0x29, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
+  0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
+  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x07, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x74, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x86, 0x8a, 0xc8, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
+  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
+  0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3a,
+  0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00
 };
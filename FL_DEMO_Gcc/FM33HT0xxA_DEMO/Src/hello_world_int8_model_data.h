@@ -1,5 +1,11 @@
 #include <cstdint>
 
-// constexpr unsigned int g_hello_world_int8_model_data_size = 2704;
-constexpr unsigned int g_hello_world_int8_model_data_size = 2696;
-extern unsigned char g_hello_world_int8_model_data[];
+/* Model data stays in flash, aligned for in-place flatbuffer access */
+#define TFLM_MODEL_DATA_ATTR    __attribute__((section(".tflm_model"), aligned(16)))
+
+// constexpr unsigned int g_hello_world_int8_model_data_size = 2696;
+constexpr unsigned int g_hello_world_int8_model_data_size = 2704;
+extern const unsigned char g_hello_world_int8_model_data[];
+
+/* Same model with batch dimension N, generated by `make batch_model` */
+extern const unsigned char g_hello_world_int8_batch_model_data[];
@@ -2,169 +2,776 @@
 
 /* include model C array and input data from sensor side */
 #include "hello_world_int8_model_data.h"
+#include "hello_world_test.h"
+
+/* include device header for SysTick cycle counting */
+#include "fm33ht0xxa.h"
+
+/* tensor arena is shared with TSI init scan buffers */
+#include "shared_arena.h"
+
+/* Cortex-M0 int8 FullyConnected kernel */
+#include "fc_int8_m0.h"
+
+/* LUT int8 Logistic/Tanh kernels */
+#include "lut_int8_m0.h"
+
+/* per-op tick accumulation */
+#include "cap_profiler.h"
+
+/* model loaded from data flash slot */
+#include "model_slot.h"
+
+#include <new>
 
 /* include tensorflow header files */
+#include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
 /* ============================================  Define  ============================================ */
+/* Invoke() count per benchmark path */
+#define BENCHMARK_LOOP_NUM      (16)
+
+/* Use Cortex-M0 int8 FullyConnected kernel instead of the prebuilt reference one.
+   Generated resolver takes the kernel from OP_RESOLVER_ARGS in Makefile instead */
+#define USE_FC_INT8_M0          (1)
+
+/* Resolve Logistic/Tanh to the LUT kernels instead of the gemmlowp fixed-point ones.
+   Set by `make LUT_ACTIVATION=1`, which also builds Src/lut_int8_m0.cpp and passes the
+   resolver class to the generated resolver. Off while the model has no Logistic/Tanh */
+#ifndef USE_LUT_ACTIVATION
+#define USE_LUT_ACTIVATION      (0)
+#endif
+
+/* Accumulate per-op ticks in every Invoke(), read by APP_CMD_GET_PROFILE_CSV */
+#define TFLM_PROFILE            (1)
+
+/* Input and output depth of the FullyConnected kernel benchmark layer */
+#define FC_BENCHMARK_DEPTH      (16)
+
+/* Build the interpreter from a valid data flash model slot, built-in model otherwise */
+#define USE_MODEL_SLOT          (1)
+
+/* Run the input sweep on the batch model, N samples per Invoke().
+   Arena shall be sized with the batch model, see ARENA_MODEL_SRC in Makefile */
+#define CAP_BATCH_MODEL         (1)
+
+/* Build CAP_MODEL_NUM models in the one tensor arena, one per widget group.
+   Arena shall be sized for all of them, see ARENA_MODEL_NUM in Makefile */
+#define USE_MODEL_REGISTRY      (1)
 
 /* ===========================================  Typedef  ============================================ */
 
 /* ==========================================  Variables  =========================================== */
 namespace {
-// int8_t y_pred[10] = {0};
-float y_pred[10] = {0.0f};
-float z_pred = 0.0f;
-
+/*Exact arena size is generated by `make arena_size`, fall back to a round number*/
+#if __has_include("tflm_arena_size.h")
+#include "tflm_arena_size.h"
+constexpr int kTensorArenaSize = TFLM_ARENA_SIZE;
+#else
+#define TFLM_ARENA_ALIGNMENT    (16)
 constexpr int kTensorArenaSize = 4 * 1024;
-static uint8_t tensor_arena[kTensorArenaSize];
+#endif
+/*Arena is taken from the shared region once TSI init is done, the region keeps
+  the alignment so that no arena byte is lost to TFLM internal alignment*/
+static_assert(kTensorArenaSize <= SHARED_ARENA_SIZE, "SHARED_ARENA_SIZE too small for tensor arena");
+static_assert(SHARED_ARENA_ALIGNMENT % TFLM_ARENA_ALIGNMENT == 0, "SHARED_ARENA_ALIGNMENT too small");
+uint8_t* tensor_arena = nullptr;
 
-using HelloWorldOpResolver = tflite::MicroMutableOpResolver<1>;
 tflite::MicroInterpreter* interpreter = nullptr;
-
-/*The operators in trained model must be registered here, or cause Hardfault*/
-TfLiteStatus RegisterOps(tflite::MicroMutableOpResolver<6> &resolver)
+tflite::MicroProfilerInterface* profiler = nullptr;
+
+/*Standalone interpreter is rebuilt in place on model switch, single and batch
+  model share the arena. It takes the first slot of the registry interpreters*/
+#if USE_MODEL_REGISTRY
+constexpr int kInterpreterNum = CAP_MODEL_NUM;
+#else
+constexpr int kInterpreterNum = 1;
+#endif
+alignas(tflite::MicroInterpreter) uint8_t interpreter_buffer[kInterpreterNum][sizeof(tflite::MicroInterpreter)];
+const unsigned char* interpreter_model = nullptr;
+/*Model the feature plugin runs: slot model or built-in one*/
+const unsigned char* base_model = g_hello_world_int8_model_data;
+
+#if USE_MODEL_REGISTRY
+/*Registry models in widget group order, the built-in model stands in for a
+  group until its own model is trained. Entry 0 is base_model, fed by the
+  feature plugin*/
+static_assert(CAP_MODEL_NUM >= 1 && CAP_MODEL_NUM <= 3, "CAP_MODEL_NUM shall be 1 to 3");
+const unsigned char* registry_models[CAP_MODEL_NUM] = {
+    g_hello_world_int8_model_data,      /* ExPad1 */
+#if CAP_MODEL_NUM > 1
+    g_hello_world_int8_model_data,      /* InPad1 */
+#endif
+#if CAP_MODEL_NUM > 2
+    g_hello_world_int8_model_data,      /* InPad2 */
+#endif
+};
+tflite::MicroInterpreter* registry[CAP_MODEL_NUM] = {nullptr};
+CapRegistryReportTypeDef registry_report = {};
+#endif
+
+/*The operators in trained model must be registered here, or cause Hardfault.
+  Exact-size resolver is generated from the model by `make op_resolver`*/
+#if __has_include("tflm_op_resolver.h")
+#include "tflm_op_resolver.h"
+TfLiteStatus RegisterOps(CapOpResolver &resolver)
 {
-  resolver.AddFullyConnected();
-  resolver.AddRelu();
-  resolver.AddLogistic();
+  return CapRegisterOps(resolver);
+}
+#else
+#if USE_LUT_ACTIVATION
+using CapOpResolver = tflite::LutActivationOpResolver<3>;
+#else
+using CapOpResolver = tflite::MicroMutableOpResolver<3>;
+#endif
+TfLiteStatus RegisterOps(CapOpResolver &resolver)
+{
+#if USE_FC_INT8_M0
+  TF_LITE_ENSURE_STATUS(resolver.AddFullyConnected(tflite::Register_FULLY_CONNECTED_INT8_M0()));
+#else
+  TF_LITE_ENSURE_STATUS(resolver.AddFullyConnected());
+#endif
+  TF_LITE_ENSURE_STATUS(resolver.AddRelu());
+  TF_LITE_ENSURE_STATUS(resolver.AddLogistic());
   return kTfLiteOk;
 }
-// TfLiteStatus RegisterOps(HelloWorldOpResolver& op_resolver) {
-//   TF_LITE_ENSURE_STATUS(op_resolver.AddFullyConnected());
-//   return kTfLiteOk;
-// }
+#endif
+CapOpResolver op_resolver;
 
-}  // namespace
-/* ====================================  Functions declaration  ===================================== */
+/*Fill tensor view from TFLM tensor, only float and int8 tensors are supported*/
+int GetTensorView(const TfLiteTensor *src, CapTensorTypeDef *tensor)
+{
+    if (src == nullptr || src->data.data == nullptr) {
+        return -1;
+    }
 
-/* ======================================  Functions define  ======================================== */
+    tensor->data = src->data.data;
+    tensor->scale = 0.0f;
+    tensor->zeroPoint = 0;
+    if (src->type == kTfLiteInt8) {
+        tensor->size = src->bytes;
+        tensor->isInt8 = 1U;
+        tensor->scale = src->params.scale;
+        tensor->zeroPoint = src->params.zero_point;
+    } else if (src->type == kTfLiteFloat32) {
+        tensor->size = src->bytes / sizeof(float);
+        tensor->isInt8 = 0U;
+    } else {
+        return -2;
+    }
+    return 0;
+}
 
-#ifdef __cplusplus
-extern "C" {
-#endif  /* __cplusplus */
+/*Destroy the standalone interpreter or all registry ones, the arena is free afterwards*/
+void ReleaseInterpreters(void)
+{
+#if USE_MODEL_REGISTRY
+    for (int i = 0; i < CAP_MODEL_NUM; ++i) {
+        if (registry[i] != nullptr) {
+            registry[i]->~MicroInterpreter();
+            registry[i] = nullptr;
+        }
+    }
+    /*Registry mode leaves interpreter_model cleared, interpreter is one of the above*/
+    if (interpreter_model == nullptr) {
+        interpreter = nullptr;
+    }
+#endif
+    if (interpreter != nullptr) {
+        interpreter->~MicroInterpreter();
+        interpreter = nullptr;
+    }
+    interpreter_model = nullptr;
+}
 
-/*Initialization and Setup of model, likely for all TFLM trained models */
-int CapClassificationSetup(void)
+/*Build interpreter for model_data alone in the tensor arena, previous ones are
+  destroyed and all their tensors are invalid afterwards*/
+int SelectModel(const unsigned char *model_data)
 {
+    if (interpreter != nullptr && interpreter_model == model_data) {
+        return 0;
+    }
+
     /*load model from trained model_data array*/
-    const tflite::Model* model =
-      ::tflite::GetModel(g_hello_world_int8_model_data);
-    // TFLITE_CHECK_EQ(model->version(), TFLITE_SCHEMA_VERSION);
+    const tflite::Model* model = ::tflite::GetModel(model_data);
     if (model->version() != TFLITE_SCHEMA_VERSION) {
         /*Version check*/
         return -1;
     }
 
-    /*Establish Op resolver*/
-    static tflite::MicroMutableOpResolver<6> op_resolver;
-    if (RegisterOps(op_resolver) != kTfLiteOk) {
-        return -2;
-    }
-    // HelloWorldOpResolver op_resolver;
-    // TF_LITE_ENSURE_STATUS(RegisterOps(op_resolver));
-    // if (RegisterOps(op_resolver) != kTfLiteOk) {
-    //     return -2;
-    // }
-
-    // Arena size just a round number. The exact arena usage can be determined
-    // using the RecordingMicroInterpreter.
-    // constexpr int kTensorArenaSize = 4 * 1024;
-    // uint8_t tensor_arena[kTensorArenaSize];
+    ReleaseInterpreters();
 
-    // tflite::MicroInterpreter interpreter(model, op_resolver, tensor_arena,
-    //                                    kTensorArenaSize);
     /*Create interpreter, use abovementioned model, op_resolver, tensor*/
-    static tflite::MicroInterpreter static_interpreter(model, op_resolver, tensor_arena, kTensorArenaSize);
-    interpreter = &static_interpreter;
+    tflite::MicroInterpreter* next = new (interpreter_buffer[0]) tflite::MicroInterpreter(
+        model, op_resolver, tensor_arena, kTensorArenaSize, nullptr, profiler);
 
     /*Allocate tensors for interpreter, if fail, need to check model size, arena size and operators*/
-    if (interpreter->AllocateTensors() != kTfLiteOk) {
+    if (next->AllocateTensors() != kTfLiteOk) {
+        next->~MicroInterpreter();
+        interpreter_model = nullptr;
         return -3;
     }
-    
-    // TF_LITE_ENSURE_STATUS(interpreter.AllocateTensors());
+    interpreter = next;
+    interpreter_model = model_data;
+    return 0;
+}
+
+#if USE_MODEL_REGISTRY
+/*Build all registry models on one allocator: persistent allocations of each
+  model stack at the arena tail, activations are planned from the arena head
+  and overlap since only one model runs at a time. Tensors of a model are only
+  valid until another one is invoked, inputs are written right before Invoke()*/
+int BuildRegistry(void)
+{
+    ReleaseInterpreters();
 
-    // /*Establish Op resolver*/
-    // static tflite::MicroMutableOpResolver<6> op_resolver;
-    // if (RegisterOps(op_resolver) != kTfLiteOk) {
-    //     return -2;
-    // }
+    tflite::MicroAllocator* allocator = tflite::MicroAllocator::Create(tensor_arena, kTensorArenaSize);
+    if (allocator == nullptr) {
+        return -3;
+    }
+    for (int i = 0; i < CAP_MODEL_NUM; ++i) {
+        const tflite::Model* model = ::tflite::GetModel(registry_models[i]);
+        if (model->version() != TFLITE_SCHEMA_VERSION) {
+            ReleaseInterpreters();
+            return -1;
+        }
+        registry[i] = new (interpreter_buffer[i]) tflite::MicroInterpreter(
+            model, op_resolver, allocator, nullptr, profiler);
+        if (registry[i]->AllocateTensors() != kTfLiteOk) {
+            ReleaseInterpreters();
+            return -3;
+        }
+    }
+    registry_report.sharedBytes = static_cast<uint32_t>(allocator->used_bytes());
+    interpreter = registry[0];
     return 0;
 }
 
+/*Arena each model uses alone, measured by building it standalone. Registry is
+  rebuilt by the caller afterwards*/
+int MeasureRegistry(void)
+{
+    registry_report.modelNum = CAP_MODEL_NUM;
+    registry_report.independentBytes = 0U;
+    for (int i = 0; i < CAP_MODEL_NUM; ++i) {
+        if (SelectModel(registry_models[i]) != 0) {
+            return -3;
+        }
+        registry_report.modelBytes[i] = static_cast<uint32_t>(interpreter->arena_used_bytes());
+        registry_report.independentBytes += registry_report.modelBytes[i];
+    }
+    return 0;
+}
+#endif
+
+/*Interpreter of registry model id, model 0 is the one the feature plugin runs*/
+tflite::MicroInterpreter* ModelInterpreter(uint32_t id)
+{
+    if (id == 0U) {
+        return interpreter;
+    }
+#if USE_MODEL_REGISTRY
+    if (id < CAP_MODEL_NUM) {
+        return registry[id];
+    }
+#endif
+    return nullptr;
+}
+
+/*Rebuild what the feature plugin runs on after a model switch*/
+int RestoreModels(void)
+{
+#if USE_MODEL_REGISTRY
+    return BuildRegistry();
+#else
+    return SelectModel(base_model);
+#endif
+}
+
+#if USE_MODEL_SLOT
+/*Slot model if the slot is valid and this build can run it: same schema, all
+  ops registered and arena large enough*/
+const unsigned char *SlotModel(void)
+{
+    const ModelSlot_HeaderTypeDef *slot = ModelSlot_Validate();
+    if (slot == nullptr) {
+        return nullptr;
+    }
+    if (slot->schemaVersion != TFLITE_SCHEMA_VERSION ||
+        slot->arenaSize > static_cast<uint32_t>(kTensorArenaSize)) {
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < slot->opNum; ++i) {
+        if (op_resolver.FindOp(static_cast<tflite::BuiltinOperator>(slot->ops[i])) == nullptr) {
+            return nullptr;
+        }
+    }
+    return ModelSlot_GetModel(slot);
+}
+#endif
+
+}  // namespace
+/* ====================================  Functions declaration  ===================================== */
+
+/* ======================================  Functions define  ======================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+/*Initialization and Setup of model, likely for all TFLM trained models */
+int CapClassificationSetup(void)
+{
+    /*Establish Op resolver, ops can be registered only once*/
+    static bool ops_registered = false;
+    if (!ops_registered) {
+        if (RegisterOps(op_resolver) != kTfLiteOk) {
+            return -2;
+        }
+        ops_registered = true;
+    }
+
+    /*Take over the shared region, TSI init must not hold it any more*/
+    if (tensor_arena == nullptr) {
+        tensor_arena = static_cast<uint8_t*>(
+            SharedArena_Acquire(SHARED_ARENA_PHASE_TFLM, kTensorArenaSize));
+        if (tensor_arena == nullptr) {
+            return -4;
+        }
+    }
+
+#if TFLM_PROFILE
+    if (CapProfiler_Init() != 0) {
+        return -5;
+    }
+    profiler = CapProfiler_Get();
+#endif
+
+    /*Single sample model serves the feature plugin, slot model is tried first.
+      Built-in model is the fallback if the slot model fails to allocate*/
+    base_model = g_hello_world_int8_model_data;
+#if USE_MODEL_SLOT
+    const unsigned char *slot_model = SlotModel();
+    if (slot_model != nullptr && SelectModel(slot_model) == 0) {
+        base_model = slot_model;
+    }
+#endif
+#if USE_MODEL_REGISTRY
+    /*Slot model may fit the arena alone but not next to the other models*/
+    registry_models[0] = base_model;
+    int ret = MeasureRegistry();
+    if (ret == 0) {
+        ret = BuildRegistry();
+    }
+    if (ret != 0 && base_model != g_hello_world_int8_model_data) {
+        base_model = g_hello_world_int8_model_data;
+        registry_models[0] = base_model;
+        ret = MeasureRegistry();
+        if (ret == 0) {
+            ret = BuildRegistry();
+        }
+    }
+    return ret;
+#else
+    return SelectModel(base_model);
+#endif
+}
+
 /*Periodic inference of the trained model*/
 int CapClassificationPerformInference(void)
 {
   /*Null pointer check*/
-  if (interpreter == nullptr || interpreter->input(0) == nullptr || interpreter->input(0)->data.f == nullptr)
+  if (interpreter == nullptr || interpreter->input(0) == nullptr || interpreter->input(0)->data.int8 == nullptr)
   {
     return -1;
   }
 
   TfLiteTensor* input = interpreter->input(0);
   constexpr int kNumTestValues = 4;
-  float golden_inputs_float[kNumTestValues] = {0.77, 1.57, 2.3, 3.14};
   int8_t golden_inputs_int8[kNumTestValues] = {0, 127, 30, 60};
 
   for (int i = 0; i < kNumTestValues; ++i) {
-    input->data.f[0] = golden_inputs_float[i];
-    // input->data.int8[0] = golden_inputs_int8[i];
-    /*Invoke() interface to execute inference by TFLM and inputed data, execution time?*/
+    input->data.int8[0] = golden_inputs_int8[i];
+    /*Invoke() interface to execute inference by TFLM and inputed data, per-op ticks go to the profiler*/
     if (interpreter->Invoke() != kTfLiteOk) {
         return -2;
     }
-
-    /*Get output from interpreter output*/
-    // float* output = interpreter->output(0)->data.f;
-    // y_pred[i] = interpreter->output(0)->data.int8[i];
-    y_pred[i] = interpreter->output(0)->data.f[0];
-
-    // TF_LITE_ENSURE_STATUS(interpreter.Invoke());
-    // float y_pred = (output->data.int8[0] - output_zero_point) * output_scale;
-    // TFLITE_CHECK_LE(abs(sin(golden_inputs_float[i]) - y_pred), epsilon);
   }
 
-  for (int i = 0; i < 300; ++i)
+  /*Sweep all int8 input codes, graph stays fully integer.
+    Batch model takes N codes per Invoke(), single model is restored afterwards.
+    Batch model is derived from the built-in one, not used with a slot model*/
+#if CAP_BATCH_MODEL
+  const bool use_batch = (base_model == g_hello_world_int8_model_data);
+  if (use_batch) {
+    if (SelectModel(g_hello_world_int8_batch_model_data) != 0) {
+      return -3;
+    }
+    input = interpreter->input(0);
+  }
+#endif
+  const int batch = input->dims->data[0];
+  for (int i = -128; i <= 127; i += batch)
   {
-    input->data.f[0] = i * 0.03f;
+    for (int b = 0; b < batch; ++b) {
+      input->data.int8[b] = (int8_t)((i + b <= 127) ? (i + b) : 127);
+    }
     if (interpreter->Invoke() != kTfLiteOk) {
         return -2;
     }
-    z_pred = interpreter->output(0)->data.f[0];
+  }
+#if CAP_BATCH_MODEL
+  if (use_batch && RestoreModels() != 0) {
+    return -3;
+  }
+#endif
 
+  return 0;
+}
+
+/*1 if the interpreter runs the data flash slot model, 0 for the built-in one*/
+int CapClassificationIsSlotModel(void)
+{
+    return (base_model != g_hello_world_int8_model_data) ? 1 : 0;
+}
+
+/*Get in-place view of input tensor, features are written directly into it*/
+int CapClassificationGetInput(CapTensorTypeDef *tensor)
+{
+    return CapModelGetInput(0U, tensor);
+}
+
+/*Get in-place view of output tensor*/
+int CapClassificationGetOutput(CapTensorTypeDef *tensor)
+{
+    return CapModelGetOutput(0U, tensor);
+}
+
+/*Run inference on current input tensor content*/
+int CapClassificationInvoke(void)
+{
+    return CapModelInvoke(0U);
+}
+
+/*Same for registry model id. Activations of all models share the arena head,
+  the input view of a model is overwritten by any other model's Invoke()*/
+int CapModelGetInput(uint32_t id, CapTensorTypeDef *tensor)
+{
+    tflite::MicroInterpreter* model = ModelInterpreter(id);
+    if (model == nullptr || tensor == nullptr) {
+        return -1;
+    }
+    return GetTensorView(model->input(0), tensor);
+}
+
+int CapModelGetOutput(uint32_t id, CapTensorTypeDef *tensor)
+{
+    tflite::MicroInterpreter* model = ModelInterpreter(id);
+    if (model == nullptr || tensor == nullptr) {
+        return -1;
+    }
+    return GetTensorView(model->output(0), tensor);
+}
+
+int CapModelInvoke(uint32_t id)
+{
+    tflite::MicroInterpreter* model = ModelInterpreter(id);
+    if (model == nullptr) {
+        return -1;
+    }
+    if (model->Invoke() != kTfLiteOk) {
+        return -2;
+    }
+    /*Guard words behind the arena catch kernels writing out of range*/
+    if (SharedArena_Check() != FL_PASS) {
+        return -3;
+    }
+    return 0;
+}
+
+/*Arena bytes of the registry against one arena per model, measured at setup*/
+int CapModelRegistryReport(CapRegistryReportTypeDef *report)
+{
+#if USE_MODEL_REGISTRY
+    if (report == nullptr || registry[0] == nullptr) {
+        return -1;
+    }
+    *report = registry_report;
+    return 0;
+#else
+    (void)report;
+    return -1;
+#endif
+}
+
+/*Compare cycles per Invoke() with float I/O against int8 I/O.
+  SysTick is borrowed as a 24-bit cycle counter, do not call with FL_DelayMs() pending*/
+int CapClassificationBenchmark(CapBenchmarkTypeDef *result)
+{
+  if (interpreter == nullptr || result == nullptr) {
+    return -1;
+  }
+
+  TfLiteTensor* input = interpreter->input(0);
+  TfLiteTensor* output = interpreter->output(0);
+  if (input == nullptr || output == nullptr ||
+      input->type != kTfLiteInt8 || output->type != kTfLiteInt8) {
+    return -1;
+  }
+
+  const float in_scale = input->params.scale;
+  const int32_t in_zero_point = input->params.zero_point;
+  const float out_scale = output->params.scale;
+  const int32_t out_zero_point = output->params.zero_point;
+  volatile float y_float = 0.0f;
+  volatile int8_t y_int8 = 0;
+  uint32_t float_cycles = 0U;
+  uint32_t int8_cycles = 0U;
+
+  SysTick->CTRL = 0U;
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0U;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+  for (int i = 0; i < BENCHMARK_LOOP_NUM; ++i) {
+    /*float I/O: quantize at input boundary, dequantize at output boundary*/
+    float x = (float)i * 0.4f;
+    uint32_t begin = SysTick->VAL;
+    int32_t q = (int32_t)(x / in_scale + 0.5f) + in_zero_point;
+    if (q > 127) { q = 127; } else if (q < -128) { q = -128; }
+    input->data.int8[0] = (int8_t)q;
+    if (interpreter->Invoke() != kTfLiteOk) {
+      SysTick->CTRL = 0U;
+      return -2;
+    }
+    y_float = (float)(output->data.int8[0] - out_zero_point) * out_scale;
+    float_cycles += (begin - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+
+    /*int8 I/O: feature already quantized, raw output compared as is*/
+    begin = SysTick->VAL;
+    input->data.int8[0] = (int8_t)(i * 16 - 128);
+    if (interpreter->Invoke() != kTfLiteOk) {
+      SysTick->CTRL = 0U;
+      return -2;
+    }
+    y_int8 = output->data.int8[0];
+    int8_cycles += (begin - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
   }
 
-  /*Convert input data into buffer and execute normalization*/
-  // float* input_buffer = interpreter->input(0)->data.f;
-  // input_buffer[0] = 0.0;
-  // input_buffer[1] = 0.5;
-  // input_buffer[2] = 1.1;
-  // input_buffer[3] = 2.0;
-  // input_buffer[4] = 3.0;
+  SysTick->CTRL = 0U;
+  (void)y_float;
+  (void)y_int8;
 
-  
+  result->floatIoCycles = float_cycles / BENCHMARK_LOOP_NUM;
+  result->int8IoCycles = int8_cycles / BENCHMARK_LOOP_NUM;
+  return 0;
+}
 
-  // TfLiteTensor* input = interpreter->input(0);
-  // constexpr int kNumTestValues = 5;
-  // float golden_inputs[kNumTestValues] = {
-  //   {0.0},
-  //   {0.5},
-  //   {1.1},
-  //   {2.0},
-  //   {3.0},
-  // };
-  // for (int i = 0; i < kNumTestValues; ++i)
-  // {
-  //   input->data.f[i] = golden_inputs[i];
-  //   TF_LITE_ENSURE_STATUS(interpreter->Invoke());
-  //   y_pred[i] = interpreter->output(0)->data.f[0];
-  // }
+/*Run the Cortex-M0 FullyConnected kernel and the reference kernel on the same
+  synthetic layer, count cycles and check outputs are bit exact.
+  Quantization params follow the model: input zero point -128, fused ReLU*/
+int CapFcKernelBenchmark(CapFcBenchmarkTypeDef *result)
+{
+  if (result == nullptr) {
+    return -1;
+  }
 
+  constexpr int kDepth = FC_BENCHMARK_DEPTH;
+  int8_t filter[kDepth * kDepth];
+  int32_t bias[kDepth];
+  int32_t folded_bias[kDepth];
+  int8_t input[kDepth];
+  int8_t ref_output[kDepth];
+  int8_t m0_output[kDepth];
+  const int32_t io_dims[2] = {1, kDepth};
+  const int32_t filter_dims[2] = {kDepth, kDepth};
+  const int32_t bias_dims[1] = {kDepth};
+  const tflite::RuntimeShape io_shape(2, io_dims);
+  const tflite::RuntimeShape filter_shape(2, filter_dims);
+  const tflite::RuntimeShape bias_shape(1, bias_dims);
+
+  tflite::FullyConnectedParams params = {};
+  params.input_offset = 128;
+  params.weights_offset = 0;
+  params.output_offset = 5;
+  params.output_multiplier = 1518500250;  /*0.707 in Q31*/
+  params.output_shift = -7;
+  params.quantized_activation_min = 5;    /*ReLU clamps at output zero point*/
+  params.quantized_activation_max = 127;
+
+  /*LCG filled data, same every run*/
+  uint32_t seed = 1U;
+  for (int i = 0; i < kDepth * kDepth; ++i) {
+    seed = seed * 1664525U + 1013904223U;
+    filter[i] = (int8_t)(seed >> 24);
+  }
+  for (int i = 0; i < kDepth; ++i) {
+    seed = seed * 1664525U + 1013904223U;
+    bias[i] = (int32_t)(seed >> 20) - 2048;
+  }
+  tflite::fc_int8_m0::FoldInputOffset(params.input_offset, filter, bias,
+                                      kDepth, kDepth, folded_bias);
+
+  uint32_t ref_cycles = 0U;
+  uint32_t m0_cycles = 0U;
+  uint32_t mismatch = 0U;
+
+  SysTick->CTRL = 0U;
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0U;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+  for (int i = 0; i < BENCHMARK_LOOP_NUM; ++i) {
+    for (int j = 0; j < kDepth; ++j) {
+      seed = seed * 1664525U + 1013904223U;
+      input[j] = (int8_t)(seed >> 24);
+    }
+
+    uint32_t begin = SysTick->VAL;
+    tflite::reference_integer_ops::FullyConnected(
+        params, io_shape, input, filter_shape, filter, bias_shape, bias,
+        io_shape, ref_output);
+    ref_cycles += (begin - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+
+    begin = SysTick->VAL;
+    tflite::fc_int8_m0::FullyConnected(params, folded_bias, 1, kDepth, kDepth,
+                                       input, filter, m0_output);
+    m0_cycles += (begin - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+
+    for (int j = 0; j < kDepth; ++j) {
+      mismatch += (ref_output[j] != m0_output[j]) ? 1U : 0U;
+    }
+  }
+
+  SysTick->CTRL = 0U;
+
+  result->refCycles = ref_cycles / BENCHMARK_LOOP_NUM;
+  result->m0Cycles = m0_cycles / BENCHMARK_LOOP_NUM;
+  result->mismatch = mismatch;
+  return (mismatch == 0U) ? 0 : -2;
+}
+
+/*Count cycles of the reference int8 Logistic and of the LUT lookup over all
+  256 input codes. Building the table runs the reference kernel on every code
+  once, so its cost is the reference cost plus Prepare() params.
+  Bit exactness is checked on host with `make lut_check`*/
+int CapActivationBenchmark(CapLutBenchmarkTypeDef *result)
+{
+#if USE_LUT_ACTIVATION
+  if (result == nullptr) {
+    return -1;
+  }
 
+  /*Input quantization covering [-8, 8), the range the reference kernel resolves*/
+  constexpr float kInputScale = 1.0f / 16;
+  constexpr int32_t kInputZeroPoint = 0;
+  int8_t lut[LUT_INT8_SIZE];
+  int8_t input[LUT_INT8_SIZE];
+  volatile int8_t output[LUT_INT8_SIZE];
+
+  for (int i = 0; i < LUT_INT8_SIZE; ++i) {
+    input[i] = (int8_t)(i - 128);
+  }
+
+  SysTick->CTRL = 0U;
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0U;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+  uint32_t begin = SysTick->VAL;
+  tflite::lut_int8_m0::BuildLogisticLut(kInputScale, kInputZeroPoint, lut);
+  result->refCycles = (begin - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+
+  begin = SysTick->VAL;
+  tflite::lut_int8_m0::Lookup(lut, LUT_INT8_SIZE, input, (int8_t *)output);
+  result->lutCycles = (begin - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+
+  SysTick->CTRL = 0U;
   return 0;
+#else
+  /*LUT kernels not built*/
+  (void)result;
+  return -1;
+#endif
+}
+
+/*Compare cycles per sample of N single-sample Invoke() calls against one batch
+  Invoke() over the same N inputs, outputs shall be identical.
+  Interpreter is switched to the batch model and back, call before the feature
+  plugin binds the input tensor*/
+int CapClassificationBatchBenchmark(CapBatchBenchmarkTypeDef *result)
+{
+  if (interpreter == nullptr || result == nullptr) {
+    return -1;
+  }
+
+  constexpr int kMaxBatch = 32;
+  int8_t batch_output[kMaxBatch];
+  uint32_t single_cycles = 0U;
+  uint32_t batch_cycles = 0U;
+  uint32_t mismatch = 0U;
+  int batch = 0;
+
+  SysTick->CTRL = 0U;
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0U;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+  /*Batch pass first to learn N*/
+  int ret = SelectModel(g_hello_world_int8_batch_model_data);
+  if (ret == 0) {
+    TfLiteTensor* input = interpreter->input(0);
+    batch = input->dims->data[0];
+    if (batch > kMaxBatch) {
+      ret = -4;
+    }
+  }
+  if (ret == 0) {
+    TfLiteTensor* input = interpreter->input(0);
+    for (int b = 0; b < batch; ++b) {
+      input->data.int8[b] = (int8_t)(b * 16 - 128);
+    }
+    uint32_t begin = SysTick->VAL;
+    ret = (interpreter->Invoke() == kTfLiteOk) ? 0 : -2;
+    batch_cycles = (begin - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+    /*Keep batch output while the single model reuses the arena*/
+    for (int b = 0; b < batch; ++b) {
+      batch_output[b] = interpreter->output(0)->data.int8[b];
+    }
+  }
+
+  /*Single pass, same inputs one by one*/
+  if (ret == 0) {
+    ret = SelectModel(g_hello_world_int8_model_data);
+  }
+  for (int b = 0; ret == 0 && b < batch; ++b) {
+    TfLiteTensor* input = interpreter->input(0);
+    uint32_t begin = SysTick->VAL;
+    input->data.int8[0] = (int8_t)(b * 16 - 128);
+    ret = (interpreter->Invoke() == kTfLiteOk) ? 0 : -2;
+    int8_t y = interpreter->output(0)->data.int8[0];
+    single_cycles += (begin - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+    mismatch += (y != batch_output[b]) ? 1U : 0U;
+  }
+
+  SysTick->CTRL = 0U;
+  /*Leave the feature plugin model in place whatever failed*/
+  if (RestoreModels() != 0 && ret == 0) {
+    ret = -3;
+  }
+  if (ret != 0) {
+    return ret;
+  }
+
+  result->batchSize = (uint32_t)batch;
+  result->singleCycles = single_cycles / (uint32_t)batch;
+  result->batchCycles = batch_cycles / (uint32_t)batch;
+  result->mismatch = mismatch;
+  return (mismatch == 0U) ? 0 : -5;
 }
 
 #ifdef __cplusplus
@@ -5,16 +5,83 @@
 extern "C" {
 #endif  /* __cplusplus */
 /* ===========================================  Includes  =========================================== */
+#include <stdint.h>
 
 /* ============================================  Define  ============================================ */
+/* Models in the registry, one per widget group. Model 0 is the one the feature plugin runs.
+   Set by `make CAP_MODEL_NUM=n`, up to 3 */
+#ifndef CAP_MODEL_NUM
+#define CAP_MODEL_NUM           (1U)
+#endif
 
 /* ===========================================  Typedef  ============================================ */
+/* View of a model input/output tensor. Data is accessed in place, no copy. */
+typedef struct
+{
+    void *data;             /* Tensor data */
+    uint32_t size;          /* Element count */
+    uint8_t isInt8;         /* 1: int8 tensor, 0: float tensor */
+    float scale;            /* Quantization scale, int8 tensor only */
+    int32_t zeroPoint;      /* Quantization zero point, int8 tensor only */
+} CapTensorTypeDef;
+
+/* Average SysTick cycles per Invoke(), including input/output handling */
+typedef struct
+{
+    uint32_t floatIoCycles;     /* float input quantized, float output dequantized */
+    uint32_t int8IoCycles;      /* int8 input written, int8 output read directly */
+} CapBenchmarkTypeDef;
+
+/* Average SysTick cycles per FullyConnected layer, reference vs Cortex-M0 kernel */
+typedef struct
+{
+    uint32_t refCycles;         /* reference_integer_ops::FullyConnected */
+    uint32_t m0Cycles;          /* Cortex-M0 kernel, bias folding done once beforehand */
+    uint32_t mismatch;          /* Output bytes differing from reference, shall be 0 */
+} CapFcBenchmarkTypeDef;
+
+/* SysTick cycles of int8 Logistic over all 256 input codes, reference vs LUT */
+typedef struct
+{
+    uint32_t refCycles;         /* reference_integer_ops::Logistic, also the table build cost */
+    uint32_t lutCycles;         /* Table lookup */
+} CapLutBenchmarkTypeDef;
+
+/* Average SysTick cycles per sample, N single Invoke() vs one batch Invoke() */
+typedef struct
+{
+    uint32_t batchSize;         /* N, leading dimension of the batch model input */
+    uint32_t singleCycles;      /* single-sample model, one Invoke() per sample */
+    uint32_t batchCycles;       /* batch model, one Invoke() per N samples */
+    uint32_t mismatch;          /* Outputs differing between both models, shall be 0 */
+} CapBatchBenchmarkTypeDef;
+
+/* Tensor arena bytes of the model registry, one shared arena vs one arena per model */
+typedef struct
+{
+    uint32_t modelNum;
+    uint32_t modelBytes[CAP_MODEL_NUM];     /* Arena used by each model alone */
+    uint32_t independentBytes;              /* Sum of modelBytes, N independent arenas */
+    uint32_t sharedBytes;                   /* Stacked persistent + largest activations */
+} CapRegistryReportTypeDef;
 
 /* ==========================================  Variables  =========================================== */
 
 /* ====================================  Functions declaration  ===================================== */
 int CapClassificationSetup(void);
 int CapClassificationPerformInference(void);
+int CapClassificationIsSlotModel(void);
+int CapClassificationGetInput(CapTensorTypeDef *tensor);
+int CapClassificationGetOutput(CapTensorTypeDef *tensor);
+int CapClassificationInvoke(void);
+int CapModelGetInput(uint32_t id, CapTensorTypeDef *tensor);
+int CapModelGetOutput(uint32_t id, CapTensorTypeDef *tensor);
+int CapModelInvoke(uint32_t id);
+int CapModelRegistryReport(CapRegistryReportTypeDef *report);
+int CapClassificationBenchmark(CapBenchmarkTypeDef *result);
+int CapFcKernelBenchmark(CapFcBenchmarkTypeDef *result);
+int CapActivationBenchmark(CapLutBenchmarkTypeDef *result);
+int CapClassificationBatchBenchmark(CapBatchBenchmarkTypeDef *result);
 /* ======================================  Functions define  ======================================== */
 
 /* =============================================  EOF  ============================================== */
@@ -0,0 +1,173 @@
+/* ===========================================  Includes  =========================================== */
+#include "lut_int8_m0.h"
+
+#include <cmath>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/cppmath.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/logistic.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/tanh.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+/* ===========================================  Typedef  ============================================ */
+namespace tflite {
+namespace {
+
+/* Same integer bits as the reference kernels and their Prepare() */
+constexpr int kInputIntegerBits = 4;
+
+struct OpDataLut {
+  int8_t lut[LUT_INT8_SIZE];
+};
+
+/*Input rescaling of the reference Logistic/Tanh Prepare()*/
+struct LutInputParams {
+  int32_t input_multiplier;
+  int input_left_shift;
+  int32_t input_range_radius;
+};
+
+/* ====================================  Functions define  ===================================== */
+LutInputParams CalculateInputParams(float input_scale)
+{
+  LutInputParams params;
+  const double input_real_multiplier =
+      static_cast<double>(input_scale) * static_cast<double>(1 << (31 - kInputIntegerBits));
+  const double q = std::frexp(input_real_multiplier, &params.input_left_shift);
+  params.input_multiplier = static_cast<int32_t>(TfLiteRound(q * (1ll << 31)));
+  params.input_range_radius =
+      CalculateInputRadius(kInputIntegerBits, params.input_left_shift, 31);
+  return params;
+}
+
+/*All int8 codes in lut index order, lut[(uint8_t)x] belongs to input x*/
+void FillInputCodes(int8_t *codes)
+{
+  for (int i = 0; i < LUT_INT8_SIZE; ++i) {
+    codes[static_cast<uint8_t>(i)] = static_cast<int8_t>(i);
+  }
+}
+
+void *Init(TfLiteContext *context, const char *buffer, size_t length)
+{
+  (void)buffer;
+  (void)length;
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpDataLut));
+}
+
+TfLiteStatus PrepareLut(TfLiteContext *context, TfLiteNode *node,
+                        float output_scale, int32_t output_zero_point,
+                        void (*build)(float, int32_t, int8_t *))
+{
+  MicroContext *micro_context = GetMicroContext(context);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  auto *data = static_cast<OpDataLut *>(node->user_data);
+
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 1);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+  TfLiteTensor *input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor *output = micro_context->AllocateTempOutputTensor(node, 0);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  /*Table holds the reference kernel output, so its output params must match*/
+  TF_LITE_ENSURE_EQ(context, output->params.zero_point, output_zero_point);
+  TF_LITE_ENSURE(context, std::abs(output->params.scale - output_scale) < 1e-8f);
+
+  build(input->params.scale, input->params.zero_point, data->lut);
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus LogisticPrepare(TfLiteContext *context, TfLiteNode *node)
+{
+  return PrepareLut(context, node, 1.0f / 256, -128, lut_int8_m0::BuildLogisticLut);
+}
+
+TfLiteStatus TanhPrepare(TfLiteContext *context, TfLiteNode *node)
+{
+  return PrepareLut(context, node, 1.0f / 128, 0, lut_int8_m0::BuildTanhLut);
+}
+
+TfLiteStatus Eval(TfLiteContext *context, TfLiteNode *node)
+{
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const auto &data = *static_cast<const OpDataLut *>(node->user_data);
+
+  const TfLiteEvalTensor *input = micro::GetEvalInput(context, node, 0);
+  TfLiteEvalTensor *output = micro::GetEvalOutput(context, node, 0);
+
+  lut_int8_m0::Lookup(data.lut,
+                      MatchingFlatSize(micro::GetTensorShape(input),
+                                       micro::GetTensorShape(output)),
+                      micro::GetTensorData<int8_t>(input),
+                      micro::GetTensorData<int8_t>(output));
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+namespace lut_int8_m0 {
+
+void BuildLogisticLut(float input_scale, int32_t input_zero_point, int8_t *lut)
+{
+  const LutInputParams params = CalculateInputParams(input_scale);
+  int8_t codes[LUT_INT8_SIZE];
+
+  FillInputCodes(codes);
+  reference_integer_ops::Logistic(input_zero_point, params.input_range_radius,
+                                  params.input_multiplier, params.input_left_shift,
+                                  LUT_INT8_SIZE, codes, lut);
+}
+
+void BuildTanhLut(float input_scale, int32_t input_zero_point, int8_t *lut)
+{
+  const LutInputParams params = CalculateInputParams(input_scale);
+  const int32_t dims[1] = {LUT_INT8_SIZE};
+  const RuntimeShape shape(1, dims);
+  int8_t codes[LUT_INT8_SIZE];
+
+  FillInputCodes(codes);
+  reference_integer_ops::Tanh(input_zero_point, params.input_range_radius,
+                              params.input_multiplier, params.input_left_shift,
+                              shape, codes, shape, lut);
+}
+
+void Lookup(const int8_t *lut, int size, const int8_t *input, int8_t *output)
+{
+  /*LDRB index + LDRSB table load per element, unrolled like the FC kernel*/
+  for (; size >= 4; size -= 4) {
+    output[0] = lut[static_cast<uint8_t>(input[0])];
+    output[1] = lut[static_cast<uint8_t>(input[1])];
+    output[2] = lut[static_cast<uint8_t>(input[2])];
+    output[3] = lut[static_cast<uint8_t>(input[3])];
+    input += 4;
+    output += 4;
+  }
+  for (; size > 0; --size) {
+    *output++ = lut[static_cast<uint8_t>(*input++)];
+  }
+}
+
+}  // namespace lut_int8_m0
+
+TFLMRegistration Register_LOGISTIC_INT8_LUT()
+{
+  return micro::RegisterOp(Init, LogisticPrepare, Eval);
+}
+
+TFLMRegistration Register_TANH_INT8_LUT()
+{
+  return micro::RegisterOp(Init, TanhPrepare, Eval);
+}
+
+}  // namespace tflite
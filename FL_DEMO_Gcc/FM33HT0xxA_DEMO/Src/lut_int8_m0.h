@@ -0,0 +1,62 @@
+#ifndef __LUT_INT8_M0_H__
+#define __LUT_INT8_M0_H__
+
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/micro_common.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+
+/* ============================================  Define  ============================================ */
+/* One output per int8 input code */
+#define LUT_INT8_SIZE           (256)
+
+/* ====================================  Functions declaration  ===================================== */
+namespace tflite {
+
+/* int8 Logistic/Tanh kernels for Cortex-M0 (no FPU): a 256-entry table is built
+   in Prepare with the reference kernel, Eval is a table lookup per element.
+   Output quantization is the one the reference kernels require:
+   Logistic scale 1/256 zero point -128, Tanh scale 1/128 zero point 0 */
+TFLMRegistration Register_LOGISTIC_INT8_LUT();
+TFLMRegistration Register_TANH_INT8_LUT();
+
+/* AddLogistic()/AddTanh() take no registration, so ops are added as usual and
+   this resolver routes the lookup of both to the LUT kernels */
+template <unsigned int tOpCount>
+class LutActivationOpResolver : public MicroMutableOpResolver<tOpCount> {
+ public:
+  const TFLMRegistration *FindOp(BuiltinOperator op) const override
+  {
+    const TFLMRegistration *registration = MicroMutableOpResolver<tOpCount>::FindOp(op);
+    if (registration == nullptr) {
+      return nullptr;
+    }
+    if (op == BuiltinOperator_LOGISTIC) {
+      return &logistic_;
+    }
+    if (op == BuiltinOperator_TANH) {
+      return &tanh_;
+    }
+    return registration;
+  }
+
+ private:
+  TFLMRegistration logistic_ = Register_LOGISTIC_INT8_LUT();
+  TFLMRegistration tanh_ = Register_TANH_INT8_LUT();
+};
+
+namespace lut_int8_m0 {
+
+/*Fill lut[(uint8_t)x] with reference_integer_ops::Logistic/Tanh of x for the
+  given input quantization, bit exact with the reference by construction*/
+void BuildLogisticLut(float input_scale, int32_t input_zero_point, int8_t *lut);
+void BuildTanhLut(float input_scale, int32_t input_zero_point, int8_t *lut);
+
+/*output[i] = lut[(uint8_t)input[i]]*/
+void Lookup(const int8_t *lut, int size, const int8_t *input, int8_t *output);
+
+}  // namespace lut_int8_m0
+}  // namespace tflite
+
+#endif
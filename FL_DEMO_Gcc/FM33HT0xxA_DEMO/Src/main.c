@@ -36,11 +36,20 @@
 #include "iwdt.h"
 #include "svd.h"
 #include "rmu.h"
+#include "timebase.h"
+#include "shared_arena.h"
+#include "event_loop.h"
+#include "cycle_counter.h"
 
 /* Library includes */
 #include "tsi.h"
 
 #include "hello_world_test.h"
+#include "cap_profiler.h"
+#include "cap_feature.h"
+#include "noise_diag.h"
+#include "telemetry.h"
+#include "tuning.h"
 
 #define LED0_GPIO    GPIOB
 #define LED0_PIN     FL_GPIO_PIN_10
@@ -52,9 +61,51 @@
 
 #define TSI_OPEN     true
 
+/* 上电后测量float/int8 I/O推理周期, FullyConnected及LUT Logistic内核周期, 单样本/批量推理周期,
+   及多模型共享arena与独立arena的内存对比 */
+#define TFLM_BENCHMARK  false
+
+/* 应用命令: 读取TFLM逐算子耗时CSV
+   exData返回CSV地址(MSB first), param0返回长度(可超过255), result返回长度(饱和到255),
+   param1非0时读取后清零统计 */
+#define APP_CMD_GET_PROFILE_CSV     (TSI_CMD_USER_BASE + 0U)
+
+/* 应用命令: 原始值噪声频谱诊断, 需`make NOISE_DIAG=1`编译
+   param1为模式(0停止, 1持续监测, 2扫描候选时钟并保留噪声最小者), 0xFF仅读取报告
+   exData返回NoiseDiagReportTypeDef地址(MSB first), result返回当前模式 */
+#define APP_CMD_NOISE_DIAG          (TSI_CMD_USER_BASE + 1U)
+
+/* 应用命令: 读取事件循环统计(唤醒次数, 扫描到回调延迟, CPU占用率)
+   exData返回EventLoop_StatsTypeDef地址(MSB first), result返回CPU占用率(%), param1非0时读取后清零最大延迟 */
+#define APP_CMD_EVENT_STATS         (TSI_CMD_USER_BASE + 2U)
+
+/* 低功耗模式下TSI_LPMBlockHandler调用周期(节拍), 与空闲扫描周期一致 */
+#define TSI_LPM_HANDLER_PERIOD_TICK (100U)
+
+#if (TSI_USE_TIMEBASE != 1U)
+#error "事件循环依赖时基节拍唤醒, 需使能TSI_USE_TIMEBASE"
+#endif
+
 /* Private function prototypes ----------------------------------------------*/
 static void SystemClockInit(void);
 
+#if(TFLM_BENCHMARK == true)
+/* 推理周期及arena占用测量结果, 调试器查看 */
+static CapBenchmarkTypeDef capBenchmark;
+static CapFcBenchmarkTypeDef capFcBenchmark;
+static CapLutBenchmarkTypeDef capLutBenchmark;
+static CapBatchBenchmarkTypeDef capBatchBenchmark;
+static CapRegistryReportTypeDef capRegistryReport;
+#endif
+
+#if (TSI_USED_IN_LPM_MODE == 1U)
+/* 上次执行低功耗阻塞扫描的节拍 */
+static uint32_t lpmHandlerTick;
+#endif
+
+/* 每次时基中断累加的节拍数, 低功耗模式下时基周期延长为TSI_LPM_HANDLER_PERIOD_TICK个节拍 */
+static volatile uint32_t timebaseTickStep = 1U;
+
 /**
   * @brief  HardFault 中断服务函数 请保留 
   * @param  None
@@ -65,6 +116,12 @@ void HardFault_Handler(void)
     RMU_Soft_SystemReset();
 }
 
+/* 周期计数器溢出中断, 计数扩展为32位 */
+void MUX18_IRQHandler(void)
+{
+    CycleCounter_IrqHandler();
+}
+
 
 /**
   * @brief  LED0(PB10) 初始化函数 
@@ -92,6 +149,12 @@ void LED_Init(void)
 
 int main(void)
 {   
+    uint32_t events;
+    uint32_t required;
+#if (TSI_USED_IN_LPM_MODE == 1U)
+    uint32_t step;
+#endif
+
     /* 使能IWDT */
     (void)IWDT_Init(FL_IWDT_PERIOD_4000MS);
 
@@ -124,6 +187,10 @@ int main(void)
 #if(TSI_OPEN == true)     
     /* Init TSI library */   
     TSI_Init(&TSI_LibHandle); 
+#if (TSI_USE_TIMEBASE == 1U)
+    /* TSI时基(LPTIM16) */
+    (void)Timebase_Init(TSI_TIMEBASE_US);
+#endif
     /* Enable all widget and start scan */
     TSI_Widget_EnableAll(&TSI_LibHandle); 
 
@@ -132,27 +199,99 @@ int main(void)
     // TSI_Widget_Enable(&TSI_LibHandle,(TSI_WidgetTypeDef *)&TSI_WidgetList.Button_ExPad1_Rx);
     // TSI_Widget_Enable(&TSI_LibHandle,(TSI_WidgetTypeDef *)&TSI_WidgetList.Button_ExPad1_Tx);
 
+    /* 模型初始化需在TSI_Start之前, 特征插件在启动时绑定模型输入 */
+    (void)CapClassificationSetup();
+#if(TFLM_BENCHMARK == true)
+    (void)CapClassificationBenchmark(&capBenchmark);
+    (void)CapFcKernelBenchmark(&capFcBenchmark);
+    (void)CapActivationBenchmark(&capLutBenchmark);
+    (void)CapClassificationBatchBenchmark(&capBatchBenchmark);
+    (void)CapModelRegistryReport(&capRegistryReport);
+#endif
+
+#if (TELEMETRY == 1)
+    /* 遥测串口及DMA, 每帧数据由插件打包发送, 不阻塞TSI_Handler */
+    (void)Telemetry_Init();
+#endif
+#if (TUNING == 1)
+    /* 调参协议共用遥测串口, 请求在主循环中处理 */
+    (void)Tuning_Init();
+#endif
+
     TSI_Start(&TSI_LibHandle);       
 #endif  
 
     /* LED 初始化 */
     //LED_Init();
 
-    //CapClassificationSetup();
     //CapClassificationPerformInference(); 
 
+    /* 事件循环: 无事件时WFI休眠, 看门狗由心跳监督清除 */
+    (void)EventLoop_Init(TSI_TIMEBASE_US);
+
     while(1)
     {    
-        /* 清狗 */
-        IWDT_Clr();
-        
-        /* LED 闪烁 */
-        //LED0_TOG();
-        FL_DelayMs(500);
+        /* 休眠等待扫描完成/时基节拍/串口接收事件 */
+        events = EventLoop_Wait();
+        EventLoop_Alive(EVENT_ALIVE_LOOP);
+        required = EVENT_ALIVE_LOOP;
 
 #if(TSI_OPEN == true) 
-        TSI_Handler(&TSI_LibHandle);
+        /* TSI运行时每个心跳周期内需至少处理一帧 */
+        if(TSI_LibHandle.status == TSI_LIB_RUNNING)
+        {
+            required |= EVENT_ALIVE_TSI;
+        }
+#if (TSI_USED_IN_LPM_MODE == 1U)
+        /* 低功耗模式下按周期使用TSI_LPMBlockHandler */
+        if(TSI_LibHandle.isLPM != 0U)
+        {
+            if(((events & EVENT_TICK) != 0U) &&
+               ((TSI_GetTick(&TSI_LibHandle) - lpmHandlerTick) >= TSI_LPM_HANDLER_PERIOD_TICK))
+            {
+                lpmHandlerTick = TSI_GetTick(&TSI_LibHandle);
+                TSI_LPMBlockHandler(&TSI_LibHandle);
+                EventLoop_Alive(EVENT_ALIVE_TSI);
+            }
+        }
+        else
+#endif
+        {
+            /* 扫描完成及软件定时器/命令处理 */
+            if((events & (EVENT_TSI_SCAN | EVENT_TICK)) != 0U)
+            {
+                TSI_Handler(&TSI_LibHandle);
+
+                /* 模型推理在扫描之外执行, 待TSI_Handler启动下一帧扫描后才推理, 与硬件扫描并行 */
+                (void)CapFeature_Process();
+#if (NOISE_DIAG == 1)
+                (void)NoiseDiag_Process();
+#endif
+#if (TELEMETRY == 1)
+                Telemetry_Process();
+#endif
+            }
+        }
+#if (TUNING == 1)
+        /* 串口接收或节拍事件, 命令执行依赖节拍推进
+           低功耗模式下仅处理参数读写, TSI命令及使能设置返回TUNING_STATUS_LPM */
+        Tuning_Process();
+#endif
+#if (TSI_USED_IN_LPM_MODE == 1U)
+        /* 低功耗模式下只需每TSI_LPM_HANDLER_PERIOD_TICK个节拍唤醒一次, 延长时基周期,
+           避免1ms节拍频繁唤醒; 退出低功耗模式后恢复1个节拍 */
+        step = (TSI_LibHandle.isLPM != 0U) ? TSI_LPM_HANDLER_PERIOD_TICK : 1U;
+        if((step != timebaseTickStep) && (Timebase_SetPeriod(TSI_TIMEBASE_US * step) == FL_PASS))
+        {
+            timebaseTickStep = step;
+        }
+#endif
 #endif        
+
+        if((events & EVENT_TICK) != 0U)
+        {
+            EventLoop_Heartbeat(required);
+        }
     }
 }
 
@@ -214,6 +353,126 @@ void SystemClockInit(void)
 void MUX19_IRQHandler(void)
 {
     TSI_Dev_Handler(TSI_LibHandle.driver);
+    if(TSI_DRV_GET_STAT(TSI_LibHandle.driver, TSI_DRV_STAT_SCAN_CPLT) != 0U)
+    {
+        EventLoop_ScanIrq();
+    }
+}
+
+#if (TSI_USE_TIMEBASE == 1U)
+/* TSI timebase interrupt handler */
+void MUX20_IRQHandler(void)
+{
+    if((FL_LPTIM16_IsEnabledIT_Update(LPTIM16) != 0U) &&
+            (FL_LPTIM16_IsActiveFlag_Update(LPTIM16) != 0U)) {
+        FL_LPTIM16_ClearFlag_Update(LPTIM16);
+        TSI_IncTick(&TSI_LibHandle, timebaseTickStep);
+        EventLoop_TickIrq(timebaseTickStep);
+    }
+}
+#endif
+
+#if (TUNING == 1)
+/* Tuning UART receive interrupt handler */
+void MUX6_IRQHandler(void)
+{
+    Tuning_UartIrqHandler();
+    EventLoop_Set(EVENT_UART_RX);
+}
+#endif
+
+/* 一帧处理完成, 心跳报到及扫描到回调延迟统计 */
+void TSI_WidgetUpdateCpltCallback(TSI_LibHandleTypeDef *handle)
+{
+    (void)handle;
+    EventLoop_ScanProcessed();
+}
+
+/* TSI初始化扫描缓存从共享内存区借用, 模型建立后TFLM独占该内存区 */
+void *TSI_ScratchAcquireCallback(TSI_LibHandleTypeDef *handle, uint32_t size)
+{
+    (void)handle;
+    return SharedArena_Acquire(SHARED_ARENA_PHASE_TSI_INIT, size);
+}
+
+void TSI_ScratchReleaseCallback(TSI_LibHandleTypeDef *handle)
+{
+    (void)handle;
+    if(SharedArena_GetPhase() == SHARED_ARENA_PHASE_TSI_INIT)
+    {
+        /* 保护字被破坏说明初始化扫描缓存越界, 等待看门狗复位 */
+        if(SharedArena_Release(SHARED_ARENA_PHASE_TSI_INIT) != FL_PASS)
+        {
+            while(1)
+            {}
+        }
+    }
+}
+
+/* 应用命令经exData返回数据地址, 高字节在前 */
+static void AppPackAddress(uint8_t *pExData, const void *ptr)
+{
+    uint32_t addr = (uint32_t)ptr;
+
+    pExData[0] = (uint8_t)((addr >> 24U) & 0xFFU);
+    pExData[1] = (uint8_t)((addr >> 16U) & 0xFFU);
+    pExData[2] = (uint8_t)((addr >> 8U) & 0xFFU);
+    pExData[3] = (uint8_t)(addr & 0xFFU);
+}
+
+uint8_t TSI_UserCommandCallback(TSI_LibHandleTypeDef *handle, uint8_t cmdCode,
+                                uint16_t param0, uint8_t param1, uint8_t *result)
+{
+    uint8_t *pExData = handle->command.map.exData;
+    const char *csv;
+    uint32_t len;
+
+    (void)param0;
+    switch(cmdCode)
+    {
+        case APP_CMD_GET_PROFILE_CSV:
+            len = CapProfiler_GetCsv(&csv);
+            AppPackAddress(pExData, csv);
+            handle->command.map.param0Hi = (uint8_t)((len >> 8U) & 0xFFU);
+            handle->command.map.param0Lo = (uint8_t)(len & 0xFFU);
+            *result = (len > 0xFFU) ? 0xFFU : (uint8_t)len;
+            if(param1 != 0U)
+            {
+                CapProfiler_Clear();
+            }
+            return 0U;
+
+#if (NOISE_DIAG == 1)
+        case APP_CMD_NOISE_DIAG:
+        {
+            const NoiseDiagReportTypeDef *pReport = NoiseDiag_GetReport();
+
+            if((param1 != 0xFFU) && (NoiseDiag_Start(param1) != 0U))
+            {
+                return 3U;
+            }
+            AppPackAddress(pExData, pReport);
+            *result = pReport->mode;
+            return 0U;
+        }
+#endif
+
+        case APP_CMD_EVENT_STATS:
+        {
+            const EventLoop_StatsTypeDef *pStats = EventLoop_GetStats();
+
+            AppPackAddress(pExData, pStats);
+            *result = (uint8_t)(pStats->busyPermille / 10U);
+            if(param1 != 0U)
+            {
+                EventLoop_ClearLatency();
+            }
+            return 0U;
+        }
+
+        default:
+            return 3U;
+    }
 }
 
 #endif
@@ -0,0 +1,162 @@
+/**
+  ****************************************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ****************************************************************************************************
+  */
+  
+#include "model_slot.h"
+
+/* 槽头长度固定, 保证模型数据16字节对齐 */
+typedef char ModelSlot_HeaderSizeCheck[(sizeof(ModelSlot_HeaderTypeDef) == 64U) ? 1 : -1];
+
+/* CRC-32参数, 与Tools/pack_model_slot.py一致 */
+#define MODEL_SLOT_CRC_POLY     (0x04C11DB7UL)
+#define MODEL_SLOT_CRC_INIT     (0xFFFFFFFFUL)
+
+/* CRC覆盖范围起点: length字段 */
+#define MODEL_SLOT_CRC_OFFSET   (12U)
+
+/**
+  * @brief  使用CRC外设计算32位字序列的CRC-32
+  * @param  data 数据首地址(字对齐)
+  * @param  wordNum 字数
+  * @retval CRC结果
+  */
+static uint32_t ModelSlot_Crc(const uint32_t *data, uint32_t wordNum)
+{
+    FL_CRC_InitTypeDef crcInit;
+    uint32_t crc;
+
+    FL_CRC_StructInit(&crcInit);
+    crcInit.initVal = MODEL_SLOT_CRC_INIT;
+    crcInit.dataWidth = FL_CRC_DATA_WIDTH_32B;
+    crcInit.reflectIn = FL_CRC_INPUT_INVERT_NONE;
+    crcInit.reflectOut = FL_CRC_OUPUT_INVERT_NONE;
+    crcInit.xorReg = 0U;
+    crcInit.xorRegState = FL_DISABLE;
+    crcInit.polynomialWidth = FL_CRC_POLYNOMIAL_32B;
+    crcInit.polynomial = MODEL_SLOT_CRC_POLY;
+    crcInit.calculatMode = FL_CRC_CALCULATE_PARALLEL;
+    (void)FL_CRC_Init(CRC, &crcInit);
+
+    while(wordNum-- != 0U)
+    {
+        FL_CRC_WriteData(CRC, *data++);
+        while(FL_CRC_IsActiveFlag_Busy(CRC) != 0U)
+        {
+        }
+    }
+    crc = FL_CRC_ReadData(CRC);
+
+    (void)FL_CRC_DeInit(CRC);
+    return crc;
+}
+
+/**
+  * @brief  校验模型槽: 标识, 版本, 长度范围及CRC
+  * @param  None
+  * @retval 槽头地址, 槽为空或校验失败时返回NULL
+  */
+const ModelSlot_HeaderTypeDef *ModelSlot_Validate(void)
+{
+    const ModelSlot_HeaderTypeDef *header = (const ModelSlot_HeaderTypeDef *)MODEL_SLOT_ADDR;
+    uint32_t wordNum;
+
+    if((header->magic != MODEL_SLOT_MAGIC) || (header->version != MODEL_SLOT_VERSION) ||
+       (header->headerSize < sizeof(ModelSlot_HeaderTypeDef)) || ((header->headerSize % 16U) != 0U) ||
+       (header->length == 0U) || (header->length > (MODEL_SLOT_SIZE - header->headerSize)) ||
+       (header->opNum > MODEL_SLOT_OP_MAX))
+    {
+        return NULL;
+    }
+
+    /* 模型按字补零, 槽头与模型连续存放 */
+    wordNum = (header->headerSize - MODEL_SLOT_CRC_OFFSET + header->length + 3U) / 4U;
+    if(ModelSlot_Crc((const uint32_t *)(MODEL_SLOT_ADDR + MODEL_SLOT_CRC_OFFSET), wordNum) != header->crc)
+    {
+        return NULL;
+    }
+    return header;
+}
+
+/**
+  * @brief  获取槽内模型数据地址
+  * @param  header 已校验的槽头
+  * @retval 模型flatbuffer首地址
+  */
+const uint8_t *ModelSlot_GetModel(const ModelSlot_HeaderTypeDef *header)
+{
+    return (const uint8_t *)header + header->headerSize;
+}
+
+/**
+  * @brief  擦除模型槽全部扇区
+  * @param  None
+  * @retval FL_FAIL: 擦除失败
+  */
+FL_ErrorStatus ModelSlot_Erase(void)
+{
+    uint32_t addr;
+
+    for(addr = MODEL_SLOT_ADDR; addr < (MODEL_SLOT_ADDR + MODEL_SLOT_SIZE); addr += FL_FLASH_DATA_SECTOR_SIZE_BYTE)
+    {
+        if(FL_FLASH_DataSectorErase(FLASH, addr) != FL_PASS)
+        {
+            return FL_FAIL;
+        }
+    }
+    return FL_PASS;
+}
+
+/**
+  * @brief  写入槽镜像(Tools/pack_model_slot.py生成), 需先擦除
+  *         槽头建议最后写入, 写入中断时槽保持无效
+  * @param  offset 槽内偏移(字节, 字对齐)
+  * @param  data 数据
+  * @param  wordNum 字数
+  * @retval FL_FAIL: 越界或编程失败
+  */
+FL_ErrorStatus ModelSlot_Write(uint32_t offset, const uint32_t *data, uint32_t wordNum)
+{
+    if(((offset % 4U) != 0U) || (offset > MODEL_SLOT_SIZE) || (wordNum > ((MODEL_SLOT_SIZE - offset) / 4U)))
+    {
+        return FL_FAIL;
+    }
+
+    while(wordNum-- != 0U)
+    {
+        if(FL_FLASH_DataProgram_Word(FLASH, MODEL_SLOT_ADDR + offset, *data++) != FL_PASS)
+        {
+            return FL_FAIL;
+        }
+        offset += 4U;
+    }
+    return FL_PASS;
+}
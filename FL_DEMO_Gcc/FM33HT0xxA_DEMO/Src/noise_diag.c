@@ -0,0 +1,318 @@
+/* ===========================================  Includes  =========================================== */
+#include "noise_diag.h"
+
+#if (NOISE_DIAG == 1)
+/* include TSI library header files */
+#include "tsi.h"
+#include "tsi_object.h"
+#include "tsi_plugin.h"
+#include <string.h>
+
+/* ============================================  Define  ============================================ */
+/* USER CONFIGURATION BEGIN */
+/* Plugin call priority(0-7). Lower value means higher priority. */
+#define NOISE_DIAG_PRIORITY             "3"
+
+/* TSI_ClockConf entry swept, shall be the clock of the widgets below */
+#define NOISE_DIAG_CLOCK_IDX            (TSI_CLOCK_SC_IDX)
+
+/* Frames dropped after a clock change, lets baseline and filters settle */
+#define NOISE_DIAG_SETTLE_FRAMES        (8U)
+
+/* Samples dropped after each monitor analysis, N/2 overlaps windows by half */
+#define NOISE_DIAG_MONITOR_HOP          (NOISE_SPECTRUM_FFT_LEN / 2U)
+/* USER CONFIGURATION END */
+
+/* Clock change sequence, reconfig is posted to the TSI command mailbox */
+#define NOISE_DIAG_RECONFIG_NONE        (0U)
+#define NOISE_DIAG_RECONFIG_REQUEST     (1U)    /* Waiting for the mailbox to be free */
+#define NOISE_DIAG_RECONFIG_RUNNING     (2U)    /* Posted, waiting for TSI_Handler() */
+
+/* ===========================================  Typedef  ============================================ */
+/* Scan clock candidate, other fields are kept from the configured clock */
+typedef struct
+{
+    uint16_t modClockPsc;
+    uint8_t snsClockSel;        /* 0: direct, 1: PRS (self-cap only), 2: SSC */
+} NoiseDiagCandTypeDef;
+
+/* ==========================================  Variables  =========================================== */
+/* USER CONFIGURATION BEGIN */
+/* Widgets whose sensors are analyzed, in channel order. Their scan group shall
+   be scanned every frame, a slow group repeats samples */
+static TSI_WidgetTypeDef *const noiseDiagWidgets[] = {
+    (TSI_WidgetTypeDef *) &TSI_WidgetList.Button_ExPad1_Rx,
+    (TSI_WidgetTypeDef *) &TSI_WidgetList.Button_ExPad1_Tx,
+};
+
+/* Sweep order, the first one is the configured clock */
+static const NoiseDiagCandTypeDef noiseDiagCands[NOISE_DIAG_CAND_NUM] = {
+    { 1U, 1U },         /* PRS */
+    { 2U, 1U },         /* PRS, half modulator clock */
+    { 1U, 2U },         /* SSC */
+    { 1U, 0U },         /* Direct */
+    { 2U, 0U },         /* Direct, half modulator clock */
+};
+/* USER CONFIGURATION END */
+
+static TSI_LibHandleTypeDef *diagHandle;
+static NoiseDiagReportTypeDef report;
+static TSI_ClockConfTypeDef origClock;  /* Clock before the sweep, candidates derive from it */
+static uint8_t reconfigState;
+static uint8_t settleCnt;
+static uint8_t refValid;
+static uint16_t refCount[NOISE_SPECTRUM_CH_MAX];
+static uint32_t captureFrames;
+#if (TSI_USE_TIMEBASE == 1U)
+static uint32_t captureTick;
+#endif  /* TSI_USE_TIMEBASE == 1U */
+
+/* ====================================  Functions declaration  ===================================== */
+static void NoiseDiag_StartedCallback(TSI_LibHandleTypeDef *handle);
+static void NoiseDiag_ValueUpdatedCallback(TSI_LibHandleTypeDef *handle);
+static void NoiseDiag_Restart(void);
+static void NoiseDiag_ApplyClock(const TSI_ClockConfTypeDef *clock, const NoiseDiagCandTypeDef *cand);
+static void NoiseDiag_Analyze(void);
+
+/* ======================================  Functions define  ======================================== */
+const NoiseDiagReportTypeDef *NoiseDiag_GetReport(void)
+{
+    return &report;
+}
+
+/*Start or stop diagnostics, stopping a sweep restores the configured clock.
+  Returns 0 on success*/
+uint8_t NoiseDiag_Start(uint8_t mode)
+{
+    if (diagHandle == NULL || report.chNum == 0U || mode > NOISE_DIAG_MODE_SWEEP) {
+        return 1U;
+    }
+
+    if (report.mode == NOISE_DIAG_MODE_SWEEP) {
+        NoiseDiag_ApplyClock(&origClock, NULL);
+    }
+
+    report.mode = mode;
+    report.analysisCnt = 0U;
+    if (mode == NOISE_DIAG_MODE_SWEEP) {
+        origClock = TSI_ClockConf[NOISE_DIAG_CLOCK_IDX];
+        memset(report.candScore, 0, sizeof(report.candScore));
+        report.candIdx = 0U;
+        report.bestIdx = 0U;
+        NoiseDiag_ApplyClock(&origClock, &noiseDiagCands[0]);
+    }
+    NoiseDiag_Restart();
+    return 0U;
+}
+
+/*Run the spectral analysis once all channels hold a full buffer and step the
+  sweep. Call from main loop after TSI_Handler(), returns 1 if analyzed*/
+uint8_t NoiseDiag_Process(void)
+{
+    uint8_t ch;
+
+    if (diagHandle == NULL) {
+        return 0U;
+    }
+
+    /* Clock change: mailbox shared with host, wait until it is free and done */
+    if (reconfigState == NOISE_DIAG_RECONFIG_REQUEST) {
+        if (diagHandle->command.map.execStat == 0U) {
+            diagHandle->command.map.cmdCode = TSI_CMD_RECONFIG;
+            diagHandle->command.map.execStat = 1U;
+            reconfigState = NOISE_DIAG_RECONFIG_RUNNING;
+        }
+        return 0U;
+    }
+    if (reconfigState == NOISE_DIAG_RECONFIG_RUNNING) {
+        if (diagHandle->command.map.execStat == 0U) {
+            reconfigState = NOISE_DIAG_RECONFIG_NONE;
+            NoiseDiag_Restart();
+        }
+        return 0U;
+    }
+
+    if (report.mode == NOISE_DIAG_MODE_OFF) {
+        return 0U;
+    }
+    for (ch = 0U; ch < report.chNum; ch++) {
+        if (NoiseSpectrum_IsReady(ch) == 0U) {
+            return 0U;
+        }
+    }
+
+    NoiseDiag_Analyze();
+    if (report.mode != NOISE_DIAG_MODE_SWEEP) {
+        return 1U;
+    }
+
+    /* Sweep scored on the noisiest channel, ties keep the earlier candidate */
+    if (report.candScore[report.candIdx] < report.candScore[report.bestIdx]) {
+        report.bestIdx = report.candIdx;
+    }
+    report.candIdx++;
+    if (report.candIdx < NOISE_DIAG_CAND_NUM) {
+        NoiseDiag_ApplyClock(&origClock, &noiseDiagCands[report.candIdx]);
+    } else {
+        NoiseDiag_ApplyClock(&origClock, &noiseDiagCands[report.bestIdx]);
+        report.mode = NOISE_DIAG_MODE_OFF;
+    }
+    return 1U;
+}
+
+static void NoiseDiag_Analyze(void)
+{
+    NoiseSpectrumResultTypeDef result;
+    uint16_t hop = (report.mode == NOISE_DIAG_MODE_SWEEP) ? NOISE_SPECTRUM_FFT_LEN :
+                   NOISE_DIAG_MONITOR_HOP;
+    uint32_t worst = 0U;
+    uint8_t ch;
+
+#if (TSI_USE_TIMEBASE == 1U)
+    if (captureFrames > 1U) {
+        report.framePeriodUs = (TSI_GetTick(diagHandle) - captureTick) * TSI_TIMEBASE_US /
+                               (captureFrames - 1U);
+    }
+#endif  /* TSI_USE_TIMEBASE == 1U */
+
+    for (ch = 0U; ch < report.chNum; ch++) {
+        NoiseDiagChannelTypeDef *pCh = &report.ch[ch];
+
+        if (NoiseSpectrum_Analyze(ch, hop, &result) != 0) {
+            continue;
+        }
+        pCh->peakBin = result.peakBin;
+        pCh->toneBin = result.toneBin;
+        pCh->variance = result.variance;
+        pCh->toneRatio = (result.meanEnergy != 0U) ? result.peakEnergy / result.meanEnergy :
+                         UINT32_MAX;
+        /* f = bin / (N * frame period), tones above half the frame rate alias */
+        pCh->toneMilliHz = 0U;
+        if (result.toneBin != 0U && report.framePeriodUs != 0U) {
+            pCh->toneMilliHz = (uint32_t)((uint64_t)result.toneBin * 1000000000ULL /
+                               ((uint64_t)NOISE_SPECTRUM_FFT_LEN * report.framePeriodUs));
+        }
+        if (result.variance > worst) {
+            worst = result.variance;
+        }
+    }
+
+    if (report.mode == NOISE_DIAG_MODE_SWEEP) {
+        report.candScore[report.candIdx] = worst;
+    }
+    report.analysisCnt++;
+}
+
+/*Write a candidate (or the clock itself when cand is NULL) and request reconfig,
+  calibration is redone for the new sensor clock*/
+static void NoiseDiag_ApplyClock(const TSI_ClockConfTypeDef *clock, const NoiseDiagCandTypeDef *cand)
+{
+    TSI_ClockConfTypeDef *pClock = &TSI_ClockConf[NOISE_DIAG_CLOCK_IDX];
+
+    *pClock = *clock;
+    if (cand != NULL) {
+        pClock->modClockPsc = cand->modClockPsc;
+        pClock->snsClockSel = cand->snsClockSel;
+    }
+    reconfigState = NOISE_DIAG_RECONFIG_REQUEST;
+}
+
+static void NoiseDiag_Restart(void)
+{
+    NoiseSpectrum_Reset();
+    settleCnt = NOISE_DIAG_SETTLE_FRAMES;
+    refValid = 0U;
+    captureFrames = 0U;
+}
+
+static void NoiseDiag_StartedCallback(TSI_LibHandleTypeDef *handle)
+{
+    uint16_t channelNum = 0U;
+
+    diagHandle = handle;
+    memset(&report, 0, sizeof(report));
+    reconfigState = NOISE_DIAG_RECONFIG_NONE;
+
+    TSI_FOREACH_OBJ(TSI_WidgetTypeDef *const *, ppWidget, noiseDiagWidgets,
+                    sizeof(noiseDiagWidgets) / sizeof(noiseDiagWidgets[0])) {
+        channelNum += (*ppWidget)->meta->sensorNum;
+    }
+    TSI_FOREACH_END()
+
+    /* Extra sensors beyond the spectrum buffers are not analyzed */
+    if (channelNum > NOISE_SPECTRUM_CH_MAX) {
+        channelNum = NOISE_SPECTRUM_CH_MAX;
+    }
+    if (NoiseSpectrum_Init((uint8_t)channelNum) == 0) {
+        report.chNum = (uint8_t)channelNum;
+    }
+}
+
+/*Raw counts relative to the first sample of the capture, mean is removed before the RFFT*/
+static void NoiseDiag_ValueUpdatedCallback(TSI_LibHandleTypeDef *handle)
+{
+    uint8_t ch = 0U;
+
+    TSI_UNUSED(handle)
+
+    if (report.mode == NOISE_DIAG_MODE_OFF || reconfigState != NOISE_DIAG_RECONFIG_NONE) {
+        return;
+    }
+    if (settleCnt != 0U) {
+        settleCnt--;
+        return;
+    }
+
+#if (TSI_USE_TIMEBASE == 1U)
+    if (captureFrames == 0U) {
+        captureTick = TSI_GetTick(diagHandle);
+    }
+#endif  /* TSI_USE_TIMEBASE == 1U */
+    captureFrames++;
+
+    TSI_FOREACH_OBJ(TSI_WidgetTypeDef *const *, ppWidget, noiseDiagWidgets,
+                    sizeof(noiseDiagWidgets) / sizeof(noiseDiagWidgets[0])) {
+        TSI_FOREACH_OBJ(TSI_SensorTypeDef *, pSensor, (*ppWidget)->meta->sensors,
+                        (*ppWidget)->meta->sensorNum) {
+            int32_t diff;
+
+            if (ch >= report.chNum) {
+                refValid = 1U;
+                return;
+            }
+            if (refValid == 0U) {
+                refCount[ch] = pSensor->rawCount[0U];
+            }
+            diff = (int32_t)pSensor->rawCount[0U] - (int32_t)refCount[ch];
+            if (diff > INT16_MAX) {
+                diff = INT16_MAX;
+            } else if (diff < INT16_MIN) {
+                diff = INT16_MIN;
+            }
+            NoiseSpectrum_Add(ch, (int16_t)diff);
+            ch++;
+        }
+        TSI_FOREACH_END()
+    }
+    TSI_FOREACH_END()
+    refValid = 1U;
+}
+
+/* Plugin registration ------------------------------------------------------*/
+TSI_PLUGIN(NoiseDiag, NOISE_DIAG_PRIORITY)
+{
+    NULL,                               /* initCompleted */
+    NULL,                               /* deInitCompleted */
+    NoiseDiag_StartedCallback,          /* started */
+    NULL,                               /* stopped */
+    NULL,                               /* widgetInitCompleted */
+    NULL,                               /* widgetScanCompleted */
+    NoiseDiag_ValueUpdatedCallback,     /* widgetValueUpdated */
+    NULL,                               /* widgetStatusUpdated */
+    NULL,                               /* getInitScanBufferAndCount */
+    NULL,                               /* processInitScanValue */
+    NULL,                               /* processInitScanSample */
+};
+#endif  /* NOISE_DIAG == 1 */
+
+/* =============================================  EOF  ============================================== */
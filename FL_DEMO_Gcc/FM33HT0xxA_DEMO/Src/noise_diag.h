@@ -0,0 +1,59 @@
+#ifndef __NOISE_DIAG_H__
+#define __NOISE_DIAG_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+#include "noise_spectrum.h"
+
+/* ============================================  Define  ============================================ */
+/* Diagnostics mode, NoiseDiag_Start() parameter */
+#define NOISE_DIAG_MODE_OFF             (0U)
+#define NOISE_DIAG_MODE_MONITOR         (1U)    /* Analyze continuously at the current scan clock */
+#define NOISE_DIAG_MODE_SWEEP           (2U)    /* Analyze each candidate scan clock, keep the quietest */
+
+/* Candidate scan clocks of the sweep */
+#define NOISE_DIAG_CAND_NUM             (5U)
+
+/* ===========================================  Typedef  ============================================ */
+/* Noise of one sensor, last analysis */
+typedef struct
+{
+    uint16_t toneBin;           /* Interference tone bin, 0: no tone */
+    uint16_t peakBin;           /* Strongest bin above DC */
+    uint32_t toneMilliHz;       /* Tone frequency as sampled by the frame rate (aliased) */
+    uint32_t toneRatio;         /* Peak bin energy over mean of other bins */
+    uint32_t variance;          /* Raw count variance, 1/16 count^2 */
+} NoiseDiagChannelTypeDef;
+
+/* Diagnostics report, read by APP_CMD_NOISE_DIAG */
+typedef struct
+{
+    uint8_t mode;               /* NOISE_DIAG_MODE_x, back to OFF when a sweep ends */
+    uint8_t chNum;              /* Valid entries in ch[] */
+    uint8_t candIdx;            /* Candidate under measurement */
+    uint8_t bestIdx;            /* Quietest candidate, applied when the sweep ends */
+    uint32_t framePeriodUs;     /* Mean frame period of the last capture, timebase only */
+    uint32_t analysisCnt;
+    uint32_t candScore[NOISE_DIAG_CAND_NUM];   /* Worst channel variance per candidate */
+    NoiseDiagChannelTypeDef ch[NOISE_SPECTRUM_CH_MAX];
+} NoiseDiagReportTypeDef;
+
+/* ==========================================  Variables  =========================================== */
+
+/* ====================================  Functions declaration  ===================================== */
+uint8_t NoiseDiag_Start(uint8_t mode);
+uint8_t NoiseDiag_Process(void);
+const NoiseDiagReportTypeDef *NoiseDiag_GetReport(void);
+/* ======================================  Functions define  ======================================== */
+
+/* =============================================  EOF  ============================================== */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif  /* __cplusplus */
+
+#endif
@@ -0,0 +1,192 @@
+/* ===========================================  Includes  =========================================== */
+#include "noise_spectrum.h"
+
+#if NOISE_DIAG
+#include <cmath>
+#include <cstddef>
+
+/* include tflite-micro signal library header files */
+#include "signal/src/circular_buffer.h"
+#include "signal/src/complex.h"
+#include "signal/src/energy.h"
+#include "signal/src/fft_auto_scale.h"
+#include "signal/src/rfft.h"
+#include "signal/src/window.h"
+
+/* ============================================  Define  ============================================ */
+/* Hann window in Q14, product is shifted back by the same */
+#define WINDOW_SHIFT            (14)
+
+/* ==========================================  Variables  =========================================== */
+namespace {
+constexpr int kFftLen = NOISE_SPECTRUM_FFT_LEN;
+constexpr int kBinNum = NOISE_SPECTRUM_BIN_NUM;
+
+/*RFFT state and one CircularBuffer per channel, carved from the pool at init*/
+alignas(8) uint8_t state_pool[NOISE_SPECTRUM_STATE_SIZE];
+void* rfft_state = nullptr;
+tflite::tflm_signal::CircularBuffer* buffers[NOISE_SPECTRUM_CH_MAX] = {nullptr};
+uint8_t ch_num = 0;
+
+int16_t window[kFftLen];
+int16_t work[kFftLen];
+Complex<int16_t> spectrum[kBinNum];
+uint32_t energy[kBinNum];
+
+/* ====================================  Functions define  ===================================== */
+/*Take size bytes from the pool, 8-byte aligned*/
+void* PoolAlloc(size_t* used, size_t size)
+{
+  size_t start = (*used + 7U) & ~static_cast<size_t>(7U);
+  if (start + size > sizeof(state_pool)) {
+    return nullptr;
+  }
+  *used = start + size;
+  return &state_pool[start];
+}
+
+/*Remove the mean, returns variance in 1/16 count^2*/
+uint32_t RemoveMean(int16_t* data)
+{
+  int32_t sum = 0;
+  uint64_t sq = 0;
+
+  for (int i = 0; i < kFftLen; ++i) {
+    sum += data[i];
+  }
+  const int32_t mean = sum / kFftLen;
+  for (int i = 0; i < kFftLen; ++i) {
+    int32_t d = data[i] - mean;
+    d = d > INT16_MAX ? INT16_MAX : (d < INT16_MIN ? INT16_MIN : d);
+    data[i] = static_cast<int16_t>(d);
+    sq += static_cast<uint64_t>(d * d);
+  }
+  return static_cast<uint32_t>((sq << 4) / kFftLen);
+}
+
+}  // namespace
+
+/*Buffers hold the newest NOISE_SPECTRUM_FFT_LEN samples of chNum channels*/
+int NoiseSpectrum_Init(uint8_t chNum)
+{
+  size_t used = 0;
+
+  ch_num = 0;
+  if (chNum == 0U || chNum > NOISE_SPECTRUM_CH_MAX) {
+    return -1;
+  }
+
+  const size_t rfft_size = tflm_signal::RfftInt16GetNeededMemory(kFftLen);
+  void* rfft_mem = PoolAlloc(&used, rfft_size);
+  if (rfft_mem == nullptr) {
+    return -1;
+  }
+  rfft_state = tflm_signal::RfftInt16Init(kFftLen, rfft_mem, rfft_size);
+  if (rfft_state == nullptr) {
+    return -1;
+  }
+
+  const size_t buffer_size = tflite::tflm_signal::CircularBufferGetNeededMemory(kFftLen);
+  for (uint8_t ch = 0; ch < chNum; ++ch) {
+    void* buffer_mem = PoolAlloc(&used, buffer_size);
+    if (buffer_mem == nullptr) {
+      return -1;
+    }
+    buffers[ch] = tflite::tflm_signal::CircularBufferInit(kFftLen, buffer_mem, buffer_size);
+    if (buffers[ch] == nullptr) {
+      return -1;
+    }
+  }
+
+  /*Periodic Hann, window sum is N/2 so bin energy of a tone does not depend on N*/
+  for (int i = 0; i < kFftLen; ++i) {
+    const float w = 0.5f - 0.5f * std::cos(6.2831853f * static_cast<float>(i) / kFftLen);
+    window[i] = static_cast<int16_t>(w * (1 << WINDOW_SHIFT) + 0.5f);
+  }
+
+  ch_num = chNum;
+  return 0;
+}
+
+void NoiseSpectrum_Reset(void)
+{
+  for (uint8_t ch = 0; ch < ch_num; ++ch) {
+    tflite::tflm_signal::CircularBufferReset(buffers[ch]);
+  }
+}
+
+/*Called per frame, the oldest sample is dropped once the buffer is full*/
+void NoiseSpectrum_Add(uint8_t ch, int16_t sample)
+{
+  if (ch >= ch_num) {
+    return;
+  }
+  if (tflite::tflm_signal::CircularBufferFull(buffers[ch])) {
+    tflite::tflm_signal::CircularBufferDiscard(buffers[ch], 1);
+  }
+  tflite::tflm_signal::CircularBufferAdd(buffers[ch], sample);
+}
+
+uint8_t NoiseSpectrum_IsReady(uint8_t ch)
+{
+  return (ch < ch_num && tflite::tflm_signal::CircularBufferFull(buffers[ch])) ? 1U : 0U;
+}
+
+/*Mean removal, auto-scale, Hann window, int16 RFFT and bin energies of the
+  buffered samples, then drop the oldest hop samples (hop < N overlaps windows)*/
+int NoiseSpectrum_Analyze(uint8_t ch, uint16_t hop, NoiseSpectrumResultTypeDef *result)
+{
+  if (NoiseSpectrum_IsReady(ch) == 0U || result == nullptr) {
+    return -1;
+  }
+
+  tflite::tflm_signal::CircularBufferGet(buffers[ch], kFftLen, work);
+  if (hop > 0U) {
+    tflite::tflm_signal::CircularBufferDiscard(buffers[ch], hop < kFftLen ? hop : kFftLen);
+  }
+
+  result->variance = RemoveMean(work);
+  result->scaleShift = tflite::tflm_signal::FftAutoScale(work, kFftLen, work);
+  tflm_signal::ApplyWindow(work, window, kFftLen, WINDOW_SHIFT, work);
+  tflm_signal::RfftInt16Apply(rfft_state, work, spectrum);
+  tflite::tflm_signal::SpectrumToEnergy(spectrum, 0, kBinNum - 1, energy);
+
+  /*DC bin holds the window leakage of the removed mean, skip it*/
+  uint16_t peak = 1;
+  uint64_t total = 0;
+  for (int i = 1; i < kBinNum; ++i) {
+    total += energy[i];
+    if (energy[i] > energy[peak]) {
+      peak = static_cast<uint16_t>(i);
+    }
+  }
+
+  /*Hann spreads a tone over the peak and its neighbours*/
+  uint64_t tone = energy[peak];
+  int others = kBinNum - 2;
+  if (peak > 1) {
+    tone += energy[peak - 1];
+    others--;
+  }
+  if (peak < kBinNum - 1) {
+    tone += energy[peak + 1];
+    others--;
+  }
+
+  result->peakBin = peak;
+  result->peakEnergy = energy[peak];
+  result->meanEnergy = static_cast<uint32_t>((total - tone) / others);
+  result->toneBin = (energy[peak] != 0U &&
+                     static_cast<uint64_t>(energy[peak]) >=
+                         static_cast<uint64_t>(result->meanEnergy) * NOISE_SPECTRUM_TONE_RATIO)
+                        ? peak : 0U;
+  return 0;
+}
+
+/*Bin energies of the last analysis, NOISE_SPECTRUM_BIN_NUM entries*/
+const uint32_t *NoiseSpectrum_GetEnergy(void)
+{
+  return energy;
+}
+
+#endif  /* NOISE_DIAG */
@@ -0,0 +1,60 @@
+#ifndef __NOISE_SPECTRUM_H__
+#define __NOISE_SPECTRUM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+/* ============================================  Define  ============================================ */
+/* Set by `make NOISE_DIAG=1`, the signal library is only in the TFLM source build */
+#ifndef NOISE_DIAG
+#define NOISE_DIAG                      (0)
+#endif
+
+/* Samples per analysis, power of two for the RFFT */
+#define NOISE_SPECTRUM_FFT_LEN          (64U)
+
+/* Bins 0..N/2 of the real FFT */
+#define NOISE_SPECTRUM_BIN_NUM          (NOISE_SPECTRUM_FFT_LEN / 2U + 1U)
+
+/* Sample buffers, one per analyzed channel */
+#define NOISE_SPECTRUM_CH_MAX           (2U)
+
+/* Static pool for the RFFT state and the sample buffers, checked at init */
+#define NOISE_SPECTRUM_STATE_SIZE       (1536U)
+
+/* Peak is reported as a tone when its energy is N times the mean of the other bins */
+#define NOISE_SPECTRUM_TONE_RATIO       (8U)
+
+/* ===========================================  Typedef  ============================================ */
+/* Result of one analysis of a channel */
+typedef struct
+{
+    uint16_t peakBin;           /* Strongest bin above DC */
+    uint16_t toneBin;           /* peakBin if it passes NOISE_SPECTRUM_TONE_RATIO, 0 otherwise */
+    uint32_t peakEnergy;        /* Energy of peakBin, auto-scaled input */
+    uint32_t meanEnergy;        /* Mean energy of the other bins above DC, same scale */
+    uint32_t variance;          /* Sample variance in 1/16 count^2, not auto-scaled */
+    int32_t scaleShift;         /* Left shift applied by the auto-scale */
+} NoiseSpectrumResultTypeDef;
+
+/* ==========================================  Variables  =========================================== */
+
+/* ====================================  Functions declaration  ===================================== */
+int NoiseSpectrum_Init(uint8_t chNum);
+void NoiseSpectrum_Reset(void);
+void NoiseSpectrum_Add(uint8_t ch, int16_t sample);
+uint8_t NoiseSpectrum_IsReady(uint8_t ch);
+int NoiseSpectrum_Analyze(uint8_t ch, uint16_t hop, NoiseSpectrumResultTypeDef *result);
+const uint32_t *NoiseSpectrum_GetEnergy(void);
+/* ======================================  Functions define  ======================================== */
+
+/* =============================================  EOF  ============================================== */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif  /* __cplusplus */
+
+#endif
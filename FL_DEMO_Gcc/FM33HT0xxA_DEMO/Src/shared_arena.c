@@ -0,0 +1,129 @@
+/**
+  ****************************************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ****************************************************************************************************
+  */
+  
+#include "shared_arena.h"
+
+/* 共享内存区, 尾部预留保护字空间 */
+static uint32_t sharedArena[(SHARED_ARENA_SIZE / 4U) + SHARED_ARENA_GUARD_NUM]
+    __attribute__((aligned(SHARED_ARENA_ALIGNMENT)));
+
+/* 当前使用阶段及保护字起始位置(字) */
+static SharedArena_PhaseTypeDef sharedArenaPhase = SHARED_ARENA_PHASE_FREE;
+static uint32_t sharedArenaGuardIdx = 0U;
+
+/**
+  * @brief  申请共享内存区
+  *         同一时刻只有一个阶段可持有, 保护字写在申请长度(按字取整)之后
+  *         持有阶段重复申请时, 长度不超过首次申请则返回同一内存区
+  * @param  phase 申请阶段
+  * @param  size 申请长度(字节)
+  * @retval 内存区首地址, 已被其他阶段持有或长度超限时返回NULL
+  */
+void *SharedArena_Acquire(SharedArena_PhaseTypeDef phase, uint32_t size)
+{
+    uint32_t i;
+
+    if((phase == SHARED_ARENA_PHASE_FREE) || (size > SHARED_ARENA_SIZE))
+    {
+        return NULL;
+    }
+    if(sharedArenaPhase != SHARED_ARENA_PHASE_FREE)
+    {
+        if((sharedArenaPhase == phase) && (((size + 3U) / 4U) <= sharedArenaGuardIdx))
+        {
+            return (void *)sharedArena;
+        }
+        return NULL;
+    }
+
+    sharedArenaPhase = phase;
+    sharedArenaGuardIdx = (size + 3U) / 4U;
+    for(i = 0U; i < SHARED_ARENA_GUARD_NUM; i++)
+    {
+        sharedArena[sharedArenaGuardIdx + i] = SHARED_ARENA_GUARD_WORD;
+    }
+
+    return (void *)sharedArena;
+}
+
+/**
+  * @brief  检查保护字
+  * @param  None
+  * @retval FL_FAIL: 使用者越界写入
+  */
+FL_ErrorStatus SharedArena_Check(void)
+{
+    uint32_t i;
+
+    if(sharedArenaPhase == SHARED_ARENA_PHASE_FREE)
+    {
+        return FL_PASS;
+    }
+    for(i = 0U; i < SHARED_ARENA_GUARD_NUM; i++)
+    {
+        if(sharedArena[sharedArenaGuardIdx + i] != SHARED_ARENA_GUARD_WORD)
+        {
+            return FL_FAIL;
+        }
+    }
+    return FL_PASS;
+}
+
+/**
+  * @brief  归还共享内存区, 归还前检查保护字
+  * @param  phase 归还阶段, 必须与持有阶段一致
+  * @retval FL_FAIL: 非持有者归还或保护字被破坏
+  */
+FL_ErrorStatus SharedArena_Release(SharedArena_PhaseTypeDef phase)
+{
+    FL_ErrorStatus status;
+
+    if((phase == SHARED_ARENA_PHASE_FREE) || (phase != sharedArenaPhase))
+    {
+        return FL_FAIL;
+    }
+
+    status = SharedArena_Check();
+    sharedArenaPhase = SHARED_ARENA_PHASE_FREE;
+    return status;
+}
+
+/**
+  * @brief  获取当前使用阶段
+  * @param  None
+  * @retval 当前使用阶段
+  */
+SharedArena_PhaseTypeDef SharedArena_GetPhase(void)
+{
+    return sharedArenaPhase;
+}
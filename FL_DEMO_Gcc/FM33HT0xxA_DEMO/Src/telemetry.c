@@ -0,0 +1,274 @@
+/* ===========================================  Includes  =========================================== */
+#include "telemetry.h"
+
+#if (TELEMETRY == 1)
+/* include TSI library header files */
+#include "tsi.h"
+#include "tsi_object.h"
+#include "tsi_plugin.h"
+#include "fm33ht0xxa_fl.h"
+#include <string.h>
+
+/* ============================================  Define  ============================================ */
+/* USER CONFIGURATION BEGIN */
+/* Plugin call priority(0-7). Lower value means higher priority. */
+#define TELEMETRY_PRIORITY              "4"
+
+/* Frames between keyframes, a host that lost a frame resyncs on the next one.
+   A host on the tuning link requests one at once (TUNING_OP_KEYFRAME), the
+   interval bounds the loss for a receive-only host */
+#define TELEMETRY_KEY_INTERVAL          (8U)
+
+/* UART and its DMA request, 8N1. The TX pin and function shall match the pin
+   table of the package */
+#define TELEMETRY_UART                  UART0
+#define TELEMETRY_UART_CLK_SRC          FL_CMU_UART0_CLK_SOURCE_APBCLK
+#define TELEMETRY_BAUDRATE              (115200U)
+#define TELEMETRY_DMA_CHANNEL           FL_DMA_CHANNEL_1
+#define TELEMETRY_DMA_REQUEST           FL_DMA_CHANNEL_UART0_TX
+#define TELEMETRY_TX_GPIO               GPIOA
+#define TELEMETRY_TX_PIN                FL_GPIO_PIN_14
+#define TELEMETRY_TX_REMAP              FL_GPIO_PINREMAP_FUNCTON0
+/* USER CONFIGURATION END */
+
+#define TELEMETRY_BUF_NONE              (0xFFU)
+
+#if (TSI_SENSOR_NUM > TELEMETRY_SENSOR_MAX)
+#error "TSI_SENSOR_NUM exceeds TELEMETRY_SENSOR_MAX"
+#endif
+
+/* ===========================================  Typedef  ============================================ */
+
+/* ==========================================  Variables  =========================================== */
+static TelemetryEncoderTypeDef encoder;
+static TelemetrySampleTypeDef samples[TSI_SENSOR_NUM];
+static uint8_t txBuf[2][TELEMETRY_FRAME_SIZE(TSI_SENSOR_NUM)];
+static uint16_t txLen[2];
+static uint8_t txActive = TELEMETRY_BUF_NONE;   /* Buffer under DMA */
+static uint8_t txPending = TELEMETRY_BUF_NONE;  /* Buffer waiting for the DMA */
+static uint8_t droppedRun;                      /* Drops since the last queued frame */
+static uint8_t decimCnt;
+static uint8_t ready;
+static TelemetryStatsTypeDef stats = { 0U, 0U, 0U, 0U, TELEMETRY_CH_ALL, 1U };
+
+/* ====================================  Functions declaration  ===================================== */
+static void Telemetry_StartedCallback(TSI_LibHandleTypeDef *handle);
+static void Telemetry_ValueUpdatedCallback(TSI_LibHandleTypeDef *handle);
+static void Telemetry_StartDma(uint8_t idx);
+static uint8_t Telemetry_AcquireBuffer(void);
+static void Telemetry_Queue(uint8_t idx);
+
+/* ======================================  Functions define  ======================================== */
+const TelemetryStatsTypeDef *Telemetry_GetStats(void)
+{
+    return &stats;
+}
+
+/*UART TX and its DMA channel, call before TSI_Start(). Returns 0 on success*/
+uint8_t Telemetry_Init(void)
+{
+    FL_GPIO_InitTypeDef GPIO_InitStruct = { 0 };
+    FL_UART_InitTypeDef UART_InitStruct = { 0 };
+    FL_DMA_InitTypeDef DMA_InitStruct = { 0 };
+
+    GPIO_InitStruct.pin           = TELEMETRY_TX_PIN;
+    GPIO_InitStruct.mode          = FL_GPIO_MODE_DIGITAL;
+    GPIO_InitStruct.outputType    = FL_GPIO_OUTPUT_PUSHPULL;
+    GPIO_InitStruct.pull          = FL_GPIO_BOTH_DISABLE;
+    GPIO_InitStruct.remapPin      = TELEMETRY_TX_REMAP;
+    GPIO_InitStruct.driveStrength = FL_GPIO_DRIVESTRENGTH_X3;
+    (void)FL_GPIO_Init(TELEMETRY_TX_GPIO, &GPIO_InitStruct);
+
+    UART_InitStruct.clockSrc          = TELEMETRY_UART_CLK_SRC;
+    UART_InitStruct.baudRate          = TELEMETRY_BAUDRATE;
+    UART_InitStruct.dataWidth         = FL_UART_DATA_WIDTH_8B;
+    UART_InitStruct.stopBits          = FL_UART_STOP_BIT_WIDTH_1B;
+    UART_InitStruct.parity            = FL_UART_PARITY_NONE;
+    UART_InitStruct.transferDirection = FL_UART_DIRECTION_TX;
+    if (FL_UART_Init(TELEMETRY_UART, &UART_InitStruct) != FL_PASS) {
+        return 1U;
+    }
+
+    FL_DMA_StructInit(&DMA_InitStruct);
+    DMA_InitStruct.periphAddress            = TELEMETRY_DMA_REQUEST;
+    DMA_InitStruct.direction                = FL_DMA_DIR_RAM_TO_PERIPHERAL;
+    DMA_InitStruct.memoryAddressIncMode     = FL_DMA_MEMORY_INC_MODE_INCREASE;
+    DMA_InitStruct.peripheralAddressIncMode = FL_DMA_PERIPHERAL_INC_MODE_NOCHANGE;
+    DMA_InitStruct.dataSize                 = FL_DMA_BANDWIDTH_8B;
+    DMA_InitStruct.priority                 = FL_DMA_PRIORITY_LOW;
+    if (FL_DMA_Init(DMA, &DMA_InitStruct, TELEMETRY_DMA_CHANNEL) != FL_PASS) {
+        return 1U;
+    }
+    FL_DMA_Enable(DMA);
+
+    ready = 1U;
+    return 0U;
+}
+
+/*Retire the finished buffer and start the pending one, never waits. Call from
+  main loop, it also runs on every frame*/
+void Telemetry_Process(void)
+{
+    if (ready == 0U) {
+        return;
+    }
+
+    if (txActive != TELEMETRY_BUF_NONE &&
+        FL_DMA_IsActiveFlag_TransferComplete(DMA, TELEMETRY_DMA_CHANNEL) != 0U) {
+        FL_DMA_ClearFlag_TransferComplete(DMA, TELEMETRY_DMA_CHANNEL);
+        txActive = TELEMETRY_BUF_NONE;
+    }
+    if (txActive == TELEMETRY_BUF_NONE && txPending != TELEMETRY_BUF_NONE) {
+        Telemetry_StartDma(txPending);
+        txPending = TELEMETRY_BUF_NONE;
+    }
+}
+
+/*Send another frame on the stream, e.g. a tuning response. Copied into a free
+  buffer, returns 1 if both are busy so the caller retries later*/
+uint8_t Telemetry_Send(const uint8_t *frame, uint16_t len)
+{
+    uint8_t idx;
+
+    if (ready == 0U || len > sizeof(txBuf[0])) {
+        return 1U;
+    }
+    Telemetry_Process();
+    idx = Telemetry_AcquireBuffer();
+    if (idx == TELEMETRY_BUF_NONE) {
+        return 1U;
+    }
+    memcpy(txBuf[idx], frame, len);
+    txLen[idx] = len;
+    Telemetry_Queue(idx);
+    return 0U;
+}
+
+/*Select the streamed channels, decimation 0 counts as 1. A resumed sensor
+  stream starts with a keyframe*/
+void Telemetry_Subscribe(uint8_t channels, uint8_t decimation)
+{
+    if ((stats.channels & TELEMETRY_CH_SENSOR) == 0U && (channels & TELEMETRY_CH_SENSOR) != 0U) {
+        TelemetryFrame_ForceKey(&encoder);
+        droppedRun = 0U;
+    }
+    stats.channels = channels & TELEMETRY_CH_ALL;
+    stats.decimation = (decimation == 0U) ? 1U : decimation;
+    decimCnt = 0U;
+}
+
+/*Next sensor frame is a keyframe, the host lost the delta chain*/
+void Telemetry_ForceKey(void)
+{
+    TelemetryFrame_ForceKey(&encoder);
+}
+
+/*Buffer neither sent nor pending, TELEMETRY_BUF_NONE if there is none*/
+static uint8_t Telemetry_AcquireBuffer(void)
+{
+    if (txActive == TELEMETRY_BUF_NONE) {
+        return 0U;
+    }
+    if (txPending == TELEMETRY_BUF_NONE) {
+        return txActive ^ 1U;
+    }
+    return TELEMETRY_BUF_NONE;
+}
+
+static void Telemetry_Queue(uint8_t idx)
+{
+    if (txActive == TELEMETRY_BUF_NONE) {
+        Telemetry_StartDma(idx);
+    } else {
+        txPending = idx;
+    }
+}
+
+static void Telemetry_StartDma(uint8_t idx)
+{
+    FL_DMA_ConfigTypeDef DMA_ConfigStruct;
+
+    DMA_ConfigStruct.peripheralAddress = (uint32_t)&TELEMETRY_UART->TXBUF;
+    DMA_ConfigStruct.memoryAddress0    = (uint32_t)txBuf[idx];
+    DMA_ConfigStruct.memoryAddress1    = 0U;
+    /* TSIZE holds the byte count minus one */
+    DMA_ConfigStruct.transmissionCount = (uint32_t)txLen[idx] - 1U;
+    FL_DMA_DisableChannel(DMA, TELEMETRY_DMA_CHANNEL);
+    (void)FL_DMA_StartTransmission(DMA, &DMA_ConfigStruct, TELEMETRY_DMA_CHANNEL);
+    txActive = idx;
+}
+
+static void Telemetry_StartedCallback(TSI_LibHandleTypeDef *handle)
+{
+    TSI_UNUSED(handle)
+
+    /* Restart after a reconfig: the host sees a keyframe first */
+    if (TelemetryFrame_Init(&encoder, (uint8_t)TSI_SENSOR_NUM, TELEMETRY_KEY_INTERVAL) != 0U) {
+        ready = 0U;
+    }
+    droppedRun = 0U;
+}
+
+/*Encode into the buffer neither sent nor pending, drop the frame if there is
+  none. The delta reference only moves on a queued frame, so drops do not
+  break the chain on the host*/
+static void Telemetry_ValueUpdatedCallback(TSI_LibHandleTypeDef *handle)
+{
+    uint8_t idx;
+    uint8_t i;
+
+    TSI_UNUSED(handle)
+
+    if (ready == 0U || (stats.channels & TELEMETRY_CH_SENSOR) == 0U) {
+        return;
+    }
+    stats.frameCnt++;
+    if (decimCnt != 0U) {
+        decimCnt--;
+        return;
+    }
+    decimCnt = stats.decimation - 1U;
+
+    Telemetry_Process();
+    idx = Telemetry_AcquireBuffer();
+    if (idx == TELEMETRY_BUF_NONE) {
+        stats.droppedCnt++;
+        if (droppedRun < UINT8_MAX) {
+            droppedRun++;
+        }
+        return;
+    }
+
+    for (i = 0U; i < TSI_SENSOR_NUM; i++) {
+        const TSI_SensorTypeDef *pSensor = TSI_SensorPointers[i];
+
+        samples[i].rawCount = pSensor->rawCount[0U];
+        samples[i].baseline = pSensor->baseline[0U];
+        samples[i].diffCount = pSensor->diffCount;
+        samples[i].status = pSensor->status;
+    }
+    txLen[idx] = TelemetryFrame_Encode(&encoder, samples, droppedRun, txBuf[idx]);
+    droppedRun = 0U;
+    stats.sentCnt++;
+    stats.byteCnt += txLen[idx];
+    Telemetry_Queue(idx);
+}
+
+/* Plugin registration ------------------------------------------------------*/
+TSI_PLUGIN(Telemetry, TELEMETRY_PRIORITY)
+{
+    NULL,                               /* initCompleted */
+    NULL,                               /* deInitCompleted */
+    Telemetry_StartedCallback,          /* started */
+    NULL,                               /* stopped */
+    NULL,                               /* widgetInitCompleted */
+    NULL,                               /* widgetScanCompleted */
+    Telemetry_ValueUpdatedCallback,     /* widgetValueUpdated */
+    NULL,                               /* widgetStatusUpdated */
+    NULL,                               /* getInitScanBufferAndCount */
+    NULL,                               /* processInitScanValue */
+    NULL,                               /* processInitScanSample */
+};
+#endif  /* TELEMETRY == 1 */
+
+/* =============================================  EOF  ============================================== */
@@ -0,0 +1,46 @@
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+#include "telemetry_frame.h"
+
+/* ============================================  Define  ============================================ */
+/* Streaming channels, Telemetry_Subscribe() mask */
+#define TELEMETRY_CH_SENSOR             (1U << 0)   /* rawCount/baseline/diffCount frames */
+#define TELEMETRY_CH_ALL                (TELEMETRY_CH_SENSOR)
+
+/* ===========================================  Typedef  ============================================ */
+/* Stream counters, a frame is dropped when both buffers are in use */
+typedef struct
+{
+    uint32_t frameCnt;          /* Frames handed to the streamer */
+    uint32_t sentCnt;           /* Frames queued for DMA */
+    uint32_t droppedCnt;
+    uint32_t byteCnt;           /* Bytes queued for DMA */
+    uint8_t channels;           /* TELEMETRY_CH_x subscribed */
+    uint8_t decimation;         /* One frame streamed every decimation frames */
+} TelemetryStatsTypeDef;
+
+/* ==========================================  Variables  =========================================== */
+
+/* ====================================  Functions declaration  ===================================== */
+uint8_t Telemetry_Init(void);
+void Telemetry_Process(void);
+uint8_t Telemetry_Send(const uint8_t *frame, uint16_t len);
+void Telemetry_Subscribe(uint8_t channels, uint8_t decimation);
+void Telemetry_ForceKey(void);
+const TelemetryStatsTypeDef *Telemetry_GetStats(void);
+/* ======================================  Functions define  ======================================== */
+
+/* =============================================  EOF  ============================================== */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif  /* __cplusplus */
+
+#endif
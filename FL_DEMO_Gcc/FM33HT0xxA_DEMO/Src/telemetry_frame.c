@@ -0,0 +1,115 @@
+/* ===========================================  Includes  =========================================== */
+#include "telemetry_frame.h"
+
+#include <string.h>
+
+/* ============================================  Define  ============================================ */
+#if (TELEMETRY_PAYLOAD_SIZE(TELEMETRY_SENSOR_MAX) > 255U)
+#error "TELEMETRY_SENSOR_MAX does not fit the one byte frame length"
+#endif
+
+/* ====================================  Functions declaration  ===================================== */
+static uint8_t *TelemetryFrame_PutVarint(uint8_t *p, int32_t delta);
+
+/* ======================================  Functions define  ======================================== */
+/*Returns 0 on success, the first frame is a keyframe*/
+uint8_t TelemetryFrame_Init(TelemetryEncoderTypeDef *enc, uint8_t sensorNum, uint8_t keyInterval)
+{
+    if (sensorNum == 0U || sensorNum > TELEMETRY_SENSOR_MAX) {
+        return 1U;
+    }
+
+    memset(enc, 0, sizeof(*enc));
+    enc->sensorNum = sensorNum;
+    enc->keyInterval = keyInterval;
+    return 0U;
+}
+
+/*Next frame is a keyframe, e.g. after the host lost one*/
+void TelemetryFrame_ForceKey(TelemetryEncoderTypeDef *enc)
+{
+    enc->keyCnt = 0U;
+}
+
+/*Encode one frame into buf of TELEMETRY_FRAME_SIZE(sensorNum) bytes and make
+  it the delta reference, so only call it for a frame that will be sent.
+  Returns the frame length*/
+uint16_t TelemetryFrame_Encode(TelemetryEncoderTypeDef *enc, const TelemetrySampleTypeDef *samples,
+                               uint8_t dropped, uint8_t *buf)
+{
+    uint8_t *p = buf + TELEMETRY_HEADER_SIZE;
+    uint16_t len;
+    uint16_t crc;
+    uint8_t key = (enc->keyCnt == 0U) ? 1U : 0U;
+    uint8_t i;
+
+    if (key != 0U) {
+        memset(enc->ref, 0, sizeof(enc->ref));
+        enc->keyCnt = enc->keyInterval;
+    } else {
+        enc->keyCnt--;
+    }
+
+    memset(p, 0, (enc->sensorNum + 7U) / 8U);
+    for (i = 0U; i < enc->sensorNum; i++) {
+        if ((samples[i].status & 0x01U) != 0U) {
+            p[i >> 3] |= (uint8_t)(1U << (i & 7U));
+        }
+    }
+    p += (enc->sensorNum + 7U) / 8U;
+
+    for (i = 0U; i < enc->sensorNum; i++) {
+        TelemetrySampleTypeDef *pRef = &enc->ref[i];
+
+        p = TelemetryFrame_PutVarint(p, (int32_t)samples[i].rawCount - (int32_t)pRef->rawCount);
+        p = TelemetryFrame_PutVarint(p, (int32_t)samples[i].baseline - (int32_t)pRef->baseline);
+        /* Wraps modulo 2^32 on both ends */
+        p = TelemetryFrame_PutVarint(p, (int32_t)((uint32_t)samples[i].diffCount -
+                                                  (uint32_t)pRef->diffCount));
+        *pRef = samples[i];
+    }
+
+    len = (uint16_t)(p - buf);
+    buf[0] = TELEMETRY_SYNC0;
+    buf[1] = TELEMETRY_SYNC1;
+    buf[2] = (uint8_t)(len - TELEMETRY_HEADER_SIZE);
+    buf[3] = (key != 0U) ? TELEMETRY_FLAG_KEY : 0U;
+    buf[4] = enc->seq++;
+    buf[5] = dropped;
+    buf[6] = enc->sensorNum;
+
+    crc = TelemetryFrame_Crc16(buf + 2U, (uint16_t)(len - 2U));
+    buf[len++] = (uint8_t)crc;
+    buf[len++] = (uint8_t)(crc >> 8);
+    return len;
+}
+
+/*CRC-16/CCITT-FALSE, bitwise: a frame is a few dozen bytes*/
+uint16_t TelemetryFrame_Crc16(const uint8_t *data, uint16_t len)
+{
+    uint16_t crc = 0xFFFFU;
+    uint8_t bit;
+
+    while (len-- != 0U) {
+        crc ^= (uint16_t)(*data++) << 8;
+        for (bit = 0U; bit < 8U; bit++) {
+            crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/*Zigzag maps small deltas of either sign to small codes, 7 bits per byte LSB first*/
+static uint8_t *TelemetryFrame_PutVarint(uint8_t *p, int32_t delta)
+{
+    uint32_t code = (delta < 0) ? ~((uint32_t)delta << 1) : ((uint32_t)delta << 1);
+
+    while (code >= 0x80U) {
+        *p++ = (uint8_t)(code | 0x80U);
+        code >>= 7;
+    }
+    *p++ = (uint8_t)code;
+    return p;
+}
+
+/* =============================================  EOF  ============================================== */
@@ -0,0 +1,75 @@
+#ifndef __TELEMETRY_FRAME_H__
+#define __TELEMETRY_FRAME_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+/* ============================================  Define  ============================================ */
+/* Telemetry frame, decoded by Tools/telemetry_decode.py:
+     [0]  0xA5, [1] 0x5A          sync
+     [2]  len                     payload bytes
+     [3]  flags                   bit0: keyframe
+     [4]  seq                     frame counter, a gap breaks the delta chain
+     [5]  dropped                 frames not queued since the previous one (saturating)
+     [6]  sensorNum
+     payload:
+          status bitmap           bit0 of each sensor status, (sensorNum + 7) / 8 bytes
+          per sensor              zigzag varint of rawCount, baseline and diffCount
+                                  minus the previous frame, minus 0 in a keyframe
+     crc16                        CCITT (0x1021, init 0xFFFF) of [2] to payload end, LSB first */
+#define TELEMETRY_SYNC0                 (0xA5U)
+#define TELEMETRY_SYNC1                 (0x5AU)
+#define TELEMETRY_FLAG_KEY              (1U << 0)
+#define TELEMETRY_HEADER_SIZE           (7U)
+#define TELEMETRY_CRC_SIZE              (2U)
+
+/* Frame size bound: varint of a 16-bit delta takes 3 bytes, a 32-bit one 5 */
+#define TELEMETRY_PAYLOAD_SIZE(N)       (((N) + 7U) / 8U + (N) * (3U + 3U + 5U))
+#define TELEMETRY_FRAME_SIZE(N)         (TELEMETRY_HEADER_SIZE + TELEMETRY_PAYLOAD_SIZE(N) + \
+                                         TELEMETRY_CRC_SIZE)
+
+/* Reference buffers of the encoder, len is one byte */
+#ifndef TELEMETRY_SENSOR_MAX
+#define TELEMETRY_SENSOR_MAX            (16U)
+#endif
+
+/* ===========================================  Typedef  ============================================ */
+/* One sensor of a frame */
+typedef struct
+{
+    uint16_t rawCount;
+    uint16_t baseline;
+    int32_t diffCount;
+    uint8_t status;
+} TelemetrySampleTypeDef;
+
+/* Encoder state, deltas are taken against the last encoded frame */
+typedef struct
+{
+    uint8_t sensorNum;
+    uint8_t seq;
+    uint8_t keyInterval;        /* Frames between keyframes, 0: keyframes only */
+    uint8_t keyCnt;             /* Frames until the next keyframe */
+    TelemetrySampleTypeDef ref[TELEMETRY_SENSOR_MAX];
+} TelemetryEncoderTypeDef;
+
+/* ==========================================  Variables  =========================================== */
+
+/* ====================================  Functions declaration  ===================================== */
+uint8_t TelemetryFrame_Init(TelemetryEncoderTypeDef *enc, uint8_t sensorNum, uint8_t keyInterval);
+void TelemetryFrame_ForceKey(TelemetryEncoderTypeDef *enc);
+uint16_t TelemetryFrame_Encode(TelemetryEncoderTypeDef *enc, const TelemetrySampleTypeDef *samples,
+                               uint8_t dropped, uint8_t *buf);
+uint16_t TelemetryFrame_Crc16(const uint8_t *data, uint16_t len);
+/* ======================================  Functions define  ======================================== */
+
+/* =============================================  EOF  ============================================== */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif  /* __cplusplus */
+
+#endif
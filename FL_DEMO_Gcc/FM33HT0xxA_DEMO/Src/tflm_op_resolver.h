@@ -0,0 +1,19 @@
+/* Generated by Tools/gen_op_resolver.py from hello_world_int8_model_data.cpp, do not edit */
+#ifndef __TFLM_OP_RESOLVER_H__
+#define __TFLM_OP_RESOLVER_H__
+
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "fc_int8_m0.h"
+
+/* Ops used by the model: FULLY_CONNECTED */
+#define TFLM_OP_NUM             (1)
+
+using CapOpResolver = tflite::MicroMutableOpResolver<TFLM_OP_NUM>;
+
+inline TfLiteStatus CapRegisterOps(CapOpResolver &resolver)
+{
+  TF_LITE_ENSURE_STATUS(resolver.AddFullyConnected(tflite::Register_FULLY_CONNECTED_INT8_M0()));
+  return kTfLiteOk;
+}
+
+#endif
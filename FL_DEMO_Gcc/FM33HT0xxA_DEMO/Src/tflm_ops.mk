@@ -0,0 +1,2 @@
+# Generated by Tools/gen_op_resolver.py from hello_world_int8_model_data.cpp, do not edit
+TFLM_KERNELS := fully_connected
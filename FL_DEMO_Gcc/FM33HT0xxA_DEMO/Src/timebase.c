@@ -0,0 +1,127 @@
+/**
+  ****************************************************************************************************
+  * @attention    
+  * Copyright 2024 SHANGHAI FUDAN MICROELECTRONICS GROUP CO., LTD.(FUDAN MICRO.)
+  *        
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met: 
+  *    
+  * 1. Redistributions of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  *    
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  *    
+  * 3. Neither the name of the copyright holder nor the names of its contributors 
+  *    may be used to endorse or promote products derived from this software without
+  *    specific prior written permission.
+  *    
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS"AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE   
+  * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+  * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.    
+  *
+  ****************************************************************************************************
+  */
+  
+#include "timebase.h"
+#include "fm33ht0xxa_fl.h"
+
+/**
+  * @brief  时基初始化, 使用LPTIM16(RCLP时钟)周期产生更新中断(MUX20)
+  *         RCLP在休眠模式下保持运行, 低功耗时时基不会停止
+  * @param  u32PeriodUs 时基周期(us), 需满足 1 <= 周期计数 <= 65536
+  * @retval FL_FAIL: 初始化失败
+  *         FL_PASS: 初始化成功
+  */
+FL_ErrorStatus Timebase_Init(uint32_t u32PeriodUs)
+{
+    FL_ErrorStatus status = FL_FAIL;
+    FL_LPTIM16_InitTypeDef LPTIM16_InitStruct;
+    uint32_t u32Count;
+
+    /* 计算周期计数 */
+    u32Count = (uint32_t)(((uint64_t)TIMEBASE_RCLP_HZ * u32PeriodUs) / 1000000U);
+    if ((u32Count == 0U) || (u32Count > 0x10000U))
+    {
+        return FL_FAIL;
+    }
+
+    /* 使能RCLP */
+    FL_CMU_RCLP_Enable();
+
+    /* LPTIM16 普通定时模式 */
+    FL_LPTIM16_StructInit(&LPTIM16_InitStruct);
+    LPTIM16_InitStruct.clockSource          = FL_CMU_LPTIM16_CLK_SOURCE_RCLP;
+    LPTIM16_InitStruct.prescalerClockSource = FL_LPTIM16_CLK_SOURCE_INTERNAL;
+    LPTIM16_InitStruct.prescaler            = FL_LPTIM16_PSC_DIV1;
+    LPTIM16_InitStruct.autoReload           = u32Count - 1U;
+    LPTIM16_InitStruct.mode                 = FL_LPTIM16_OPERATION_MODE_NORMAL;
+    LPTIM16_InitStruct.onePulseMode         = FL_LPTIM16_ONE_PULSE_MODE_CONTINUOUS;
+    status = FL_LPTIM16_Init(LPTIM16, &LPTIM16_InitStruct);
+    if (FL_PASS != status)
+    {
+        return status;
+    }
+
+    /* 使能更新中断 */
+    FL_LPTIM16_ClearFlag_Update(LPTIM16);
+    FL_LPTIM16_EnableIT_Update(LPTIM16);
+
+    /* 配置INTMUX及NVIC */
+    FL_INTMUX_SetMUX20SEL(FL_INTMUX_MUX20SEL_LPTIM);
+    NVIC_DisableIRQ(MUX20_IRQn);
+    NVIC_ClearPendingIRQ(MUX20_IRQn);
+    NVIC_SetPriority(MUX20_IRQn, TIMEBASE_IRQ_PRIORITY);
+    NVIC_EnableIRQ(MUX20_IRQn);
+
+    /* 启动定时器 */
+    FL_LPTIM16_Enable(LPTIM16);
+
+    return status;
+}
+
+/**
+  * @brief  修改时基周期, 定时器重新启动, 当前周期已计的部分丢弃
+  * @param  u32PeriodUs 时基周期(us), 范围同Timebase_Init
+  * @retval FL_FAIL: 周期超出范围, 周期不变
+  *         FL_PASS: 修改成功
+  */
+FL_ErrorStatus Timebase_SetPeriod(uint32_t u32PeriodUs)
+{
+    uint32_t u32Count;
+
+    u32Count = (uint32_t)(((uint64_t)TIMEBASE_RCLP_HZ * u32PeriodUs) / 1000000U);
+    if ((u32Count == 0U) || (u32Count > 0x10000U))
+    {
+        return FL_FAIL;
+    }
+
+    /* 缩短周期时计数值可能已超过新的重载值, 停止后从0重新计数 */
+    FL_LPTIM16_Disable(LPTIM16);
+    FL_LPTIM16_WriteAutoReload(LPTIM16, u32Count - 1U);
+    FL_LPTIM16_ClearFlag_Update(LPTIM16);
+    FL_LPTIM16_Enable(LPTIM16);
+
+    return FL_PASS;
+}
+
+/**
+  * @brief  时基关闭
+  * @param  None
+  * @retval None
+  */
+void Timebase_DeInit(void)
+{
+    NVIC_DisableIRQ(MUX20_IRQn);
+    FL_LPTIM16_DisableIT_Update(LPTIM16);
+    (void)FL_LPTIM16_DeInit(LPTIM16);
+}
+
@@ -0,0 +1,588 @@
+/* ===========================================  Includes  =========================================== */
+#include "tuning.h"
+
+#if (TUNING == 1)
+/* include TSI library header files */
+#include "tsi.h"
+#include "tsi_object.h"
+#include "fm33ht0xxa_fl.h"
+#include "telemetry.h"
+#include <string.h>
+
+/* ============================================  Define  ============================================ */
+/* USER CONFIGURATION BEGIN */
+/* Requests buffered while one runs, a full queue drops the newest */
+#define TUNING_QUEUE_DEPTH              (4U)
+
+/* Receive ring, power of two up to 256 */
+#define TUNING_RX_RING_SIZE             (128U)
+
+/* Telemetry UART, RX side. The RX pin and function shall match the pin table
+   of the package */
+#define TUNING_UART                     UART0
+#define TUNING_IRQn                     MUX6_IRQn
+#define TUNING_IRQ_PRIORITY             (3U)
+#define TUNING_RX_GPIO                  GPIOA
+#define TUNING_RX_PIN                   FL_GPIO_PIN_13
+#define TUNING_RX_REMAP                 FL_GPIO_PINREMAP_FUNCTON0
+/* USER CONFIGURATION END */
+
+#define TUNING_VERSION                  (1U)
+#define TUNING_HEADER_SIZE              (3U)    /* Sync, len */
+#define TUNING_STATUS_PENDING           (0xFFU) /* Internal, mailbox job still running */
+
+#if ((TSI_SENSOR_BSLN_ALWAYS_UPDATE == 0U) && (TSI_SENSOR_BSLN_USE_LTA == 1U))
+#define TUNING_DETCONF_SIZE             (12U + 8U)
+#else
+#define TUNING_DETCONF_SIZE             (12U)
+#endif
+
+/* Widget enable mask write: stop, one command per changed widget, start, reconfig */
+#define TUNING_STEP_MAX                 (TSI_WIDGET_NUM + 3U)
+
+#if (TUNING_FRAME_SIZE > TELEMETRY_FRAME_SIZE(TSI_SENSOR_NUM))
+#error "TUNING_PAYLOAD_MAX does not fit the telemetry transmit buffer"
+#endif
+#if (TSI_WIDGET_NUM > 32U)
+#error "Widget enable mask is 32 bits"
+#endif
+
+/* ===========================================  Typedef  ============================================ */
+typedef struct
+{
+    uint8_t tag;
+    uint8_t op;
+    uint8_t len;                /* Payload bytes */
+    uint8_t payload[TUNING_PAYLOAD_MAX];
+} TuningRequestTypeDef;
+
+/* One command through the TSI_LibHandle.command mailbox */
+typedef struct
+{
+    uint8_t cmdCode;
+    uint8_t param1;
+    uint16_t param0;
+} TuningStepTypeDef;
+
+/* ==========================================  Variables  =========================================== */
+static TuningStatsTypeDef stats;
+static volatile uint8_t rxRing[TUNING_RX_RING_SIZE];
+static volatile uint8_t rxHead;                 /* Written by the UART interrupt */
+static uint8_t rxTail;
+static uint8_t rxFrame[TUNING_FRAME_SIZE];
+static uint8_t rxPos;
+
+static TuningRequestTypeDef queue[TUNING_QUEUE_DEPTH];
+static uint8_t queueHead;
+static uint8_t queueNum;
+
+static TuningStepTypeDef jobSteps[TUNING_STEP_MAX];
+static uint8_t jobNum;                          /* 0: no mailbox job */
+static uint8_t jobIdx;
+static uint8_t jobPosted;
+static uint8_t jobExecStat;
+static uint8_t jobResult;
+static uint8_t jobExData[4];
+
+static uint8_t respBuf[TUNING_FRAME_SIZE];
+static uint16_t respLen;                        /* Response waiting for a transmit buffer */
+static uint8_t ready;
+
+/* ====================================  Functions declaration  ===================================== */
+static void Tuning_Receive(void);
+static void Tuning_ParseByte(uint8_t byte);
+static uint8_t Tuning_Execute(const TuningRequestTypeDef *req, uint8_t *pOut, uint8_t *pOutLen);
+static uint8_t Tuning_RunJob(void);
+static uint8_t Tuning_CheckRange(const TuningRequestTypeDef *req, uint8_t entrySize, uint8_t write);
+static void Tuning_Respond(const TuningRequestTypeDef *req, uint8_t status, uint8_t payloadLen);
+static uint8_t *Tuning_PutU16(uint8_t *p, uint16_t value);
+static uint8_t *Tuning_PutU32(uint8_t *p, uint32_t value);
+static uint16_t Tuning_GetU16(const uint8_t *p);
+
+/* ======================================  Functions define  ======================================== */
+const TuningStatsTypeDef *Tuning_GetStats(void)
+{
+    return &stats;
+}
+
+/*RX side of the telemetry UART, call after Telemetry_Init(). Returns 0 on success*/
+uint8_t Tuning_Init(void)
+{
+    FL_GPIO_InitTypeDef GPIO_InitStruct = { 0 };
+
+    GPIO_InitStruct.pin           = TUNING_RX_PIN;
+    GPIO_InitStruct.mode          = FL_GPIO_MODE_DIGITAL;
+    GPIO_InitStruct.outputType    = FL_GPIO_OUTPUT_PUSHPULL;
+    GPIO_InitStruct.pull          = FL_GPIO_PULLUP_ENABLE;
+    GPIO_InitStruct.remapPin      = TUNING_RX_REMAP;
+    GPIO_InitStruct.driveStrength = FL_GPIO_DRIVESTRENGTH_X3;
+    (void)FL_GPIO_Init(TUNING_RX_GPIO, &GPIO_InitStruct);
+
+    FL_UART_ClearFlag_RXBuffOverflowError(TUNING_UART);
+    FL_UART_EnableRX(TUNING_UART);
+    FL_UART_EnableIT_RXBuffFull(TUNING_UART);
+
+    /* 配置INTMUX及NVIC */
+    FL_INTMUX_SetMUX6SEL(FL_INTMUX_MUX6SEL_UART0);
+    NVIC_DisableIRQ(TUNING_IRQn);
+    NVIC_ClearPendingIRQ(TUNING_IRQn);
+    NVIC_SetPriority(TUNING_IRQn, TUNING_IRQ_PRIORITY);
+    NVIC_EnableIRQ(TUNING_IRQn);
+
+    ready = 1U;
+    return 0U;
+}
+
+/*Received bytes only go to the ring, frames are parsed in Tuning_Process()*/
+void Tuning_UartIrqHandler(void)
+{
+    uint8_t next;
+    uint8_t byte;
+
+    if (FL_UART_IsActiveFlag_RXBuffOverflowError(TUNING_UART) != 0U) {
+        FL_UART_ClearFlag_RXBuffOverflowError(TUNING_UART);
+        stats.rxOverflowCnt++;
+    }
+    if ((FL_UART_IsEnabledIT_RXBuffFull(TUNING_UART) != 0U) &&
+        (FL_UART_IsActiveFlag_RXBuffFull(TUNING_UART) != 0U)) {
+        byte = (uint8_t)FL_UART_ReadRXBuff(TUNING_UART);
+        next = (uint8_t)((rxHead + 1U) & (TUNING_RX_RING_SIZE - 1U));
+        if (next == rxTail) {
+            stats.rxOverflowCnt++;
+        } else {
+            rxRing[rxHead] = byte;
+            rxHead = next;
+        }
+    }
+}
+
+/*Parse received requests, run the queue head and send its response. Call
+  from main loop after TSI_Handler(), outside the scan path. Mailbox commands
+  take one TSI_Handler() call each, the other operations finish here*/
+void Tuning_Process(void)
+{
+    TuningRequestTypeDef *req;
+    uint8_t *pOut = &respBuf[TUNING_HEADER_SIZE + 3U];
+    uint8_t outLen = 0U;
+    uint8_t status;
+
+    if (ready == 0U) {
+        return;
+    }
+    Tuning_Receive();
+
+    /* Previous response first, the host waits for it before the next tag */
+    if (respLen != 0U) {
+        if (Telemetry_Send(respBuf, respLen) != 0U) {
+            return;
+        }
+        respLen = 0U;
+    }
+    if (queueNum == 0U) {
+        return;
+    }
+
+    req = &queue[queueHead];
+    if (jobNum == 0U) {
+        status = Tuning_Execute(req, pOut, &outLen);
+    } else {
+        status = Tuning_RunJob();
+    }
+    if (status == TUNING_STATUS_PENDING) {
+        return;
+    }
+    if (jobNum != 0U) {
+        /* Mailbox job done, last step's outcome */
+        pOut[0] = jobExecStat;
+        pOut[1] = jobResult;
+        memcpy(&pOut[2], jobExData, sizeof(jobExData));
+        outLen = 6U;
+        jobNum = 0U;
+    }
+
+    Tuning_Respond(req, status, outLen);
+    queueHead = (uint8_t)((queueHead + 1U) % TUNING_QUEUE_DEPTH);
+    queueNum--;
+    if (Telemetry_Send(respBuf, respLen) == 0U) {
+        respLen = 0U;
+    }
+}
+
+static void Tuning_Receive(void)
+{
+    while (rxTail != rxHead) {
+        Tuning_ParseByte(rxRing[rxTail]);
+        rxTail = (uint8_t)((rxTail + 1U) & (TUNING_RX_RING_SIZE - 1U));
+    }
+}
+
+static void Tuning_ParseByte(uint8_t byte)
+{
+    TuningRequestTypeDef *req;
+    uint16_t size;
+    uint16_t crc;
+
+    if (rxPos == 0U && byte != TELEMETRY_SYNC0) {
+        return;
+    }
+    if (rxPos == 1U && byte != TUNING_SYNC1) {
+        rxPos = (byte == TELEMETRY_SYNC0) ? 1U : 0U;
+        return;
+    }
+    if (rxPos == 2U && (byte < 2U || byte > 2U + TUNING_PAYLOAD_MAX)) {
+        rxPos = 0U;
+        return;
+    }
+    rxFrame[rxPos++] = byte;
+
+    size = TUNING_HEADER_SIZE + (uint16_t)rxFrame[2] + TELEMETRY_CRC_SIZE;
+    if (rxPos < 3U || rxPos < size) {
+        return;
+    }
+    rxPos = 0U;
+
+    crc = TelemetryFrame_Crc16(&rxFrame[2], (uint16_t)(size - 2U - TELEMETRY_CRC_SIZE));
+    if ((uint8_t)crc != rxFrame[size - 2U] || (uint8_t)(crc >> 8) != rxFrame[size - 1U]) {
+        stats.crcErrorCnt++;
+        return;
+    }
+    if (queueNum >= TUNING_QUEUE_DEPTH) {
+        stats.queueFullCnt++;
+        return;
+    }
+
+    req = &queue[(queueHead + queueNum) % TUNING_QUEUE_DEPTH];
+    req->tag = rxFrame[3];
+    req->op = rxFrame[4];
+    req->len = (uint8_t)(rxFrame[2] - 2U);
+    memcpy(req->payload, &rxFrame[5], req->len);
+    queueNum++;
+    stats.requestCnt++;
+}
+
+/*Run one request. Parameters are written between TSI_Handler() calls and take
+  effect on the next frame; library commands are set up as a mailbox job*/
+static uint8_t Tuning_Execute(const TuningRequestTypeDef *req, uint8_t *pOut, uint8_t *pOutLen)
+{
+    const uint8_t *pIn = req->payload;
+    uint8_t *p = pOut;
+    uint8_t i;
+
+#if (TSI_USED_IN_LPM_MODE == 1U)
+    /* TSI_LPMBlockHandler() does not run the mailbox, a job would wait for the
+       next touch. Parameter operations still work between the LPM scans */
+    if ((req->op == TUNING_OP_TSI_CMD || req->op == TUNING_OP_WRITE_ENABLE) &&
+        TSI_LibHandle.isLPM != 0U) {
+        return TUNING_STATUS_LPM;
+    }
+#endif
+
+    switch (req->op) {
+        case TUNING_OP_INFO:
+            *p++ = TUNING_VERSION;
+            *p++ = (uint8_t)TSI_WIDGET_NUM;
+            *p++ = (uint8_t)TSI_SENSOR_NUM;
+            *p++ = TUNING_DETCONF_SIZE;
+            *p++ = TUNING_FILTER_SIZE;
+            *p++ = TUNING_PAYLOAD_MAX;
+            *p++ = TUNING_QUEUE_DEPTH;
+            *p++ = (uint8_t)TSI_LibHandle.status;
+            break;
+
+        case TUNING_OP_TSI_CMD:
+            /* Existing TSI_CMD_x and application codes, same fields as the mailbox */
+            if (req->len != 4U || pIn[0] > 0x3FU) {
+                return TUNING_STATUS_BAD_PARAM;
+            }
+            jobSteps[0].cmdCode = pIn[0];
+            jobSteps[0].param0 = (uint16_t)(((uint16_t)pIn[1] << 8) | pIn[2]);
+            jobSteps[0].param1 = pIn[3];
+            jobNum = 1U;
+            break;
+
+        case TUNING_OP_READ_DETCONF:
+        case TUNING_OP_READ_FILTER: {
+            uint8_t size = (req->op == TUNING_OP_READ_DETCONF) ? TUNING_DETCONF_SIZE :
+                           TUNING_FILTER_SIZE;
+
+            if (Tuning_CheckRange(req, size, 0U) != 0U) {
+                return TUNING_STATUS_BAD_PARAM;
+            }
+            *p++ = pIn[0];
+            *p++ = pIn[1];
+            for (i = pIn[0]; i < pIn[0] + pIn[1]; i++) {
+                const TSI_WidgetTypeDef *pWidget = TSI_WidgetPointers[i];
+                const TSI_DetectConfTypeDef *pConf = &pWidget->detConf;
+
+                if (req->op == TUNING_OP_READ_DETCONF) {
+                    p = Tuning_PutU16(p, pConf->activeTh);
+                    p = Tuning_PutU16(p, pConf->activeHys);
+                    p = Tuning_PutU16(p, pConf->noiseTh);
+                    p = Tuning_PutU16(p, pConf->negNoiseTh);
+                    *p++ = pConf->onDebounce;
+                    *p++ = pConf->offDebounce;
+                    p = Tuning_PutU16(p, pConf->bslnNegStopTimeout);
+#if ((TSI_SENSOR_BSLN_ALWAYS_UPDATE == 0U) && (TSI_SENSOR_BSLN_USE_LTA == 1U))
+                    p = Tuning_PutU16(p, pConf->ltaNegErrTh);
+                    *p++ = pConf->ltaOnDebounce;
+                    *p++ = pConf->ltaNegErrorDebounce;
+                    p = Tuning_PutU16(p, pConf->ltaActiveTimeout);
+                    p = Tuning_PutU16(p, pConf->ltaNormBslnStopTimeout);
+#endif
+                } else {
+                    uint16_t activeTh = 0U;
+                    uint16_t detectTh = 0U;
+
+#if (TSI_PROX_FILTER_ADVIIR_EN == 1U)
+                    if (pWidget->meta->type == TSI_WIDGET_SELF_CAP_PROXIMITY) {
+                        const TSI_SelfCapProximityTypeDef *pProx =
+                            (const TSI_SelfCapProximityTypeDef *)pWidget;
+                        activeTh = pProx->filterActiveTh;
+                        detectTh = (uint16_t)pProx->filterDetectTh;
+                    }
+#endif
+                    *p++ = pConf->bslnIIRCoeff;
+                    p = Tuning_PutU16(p, activeTh);
+                    p = Tuning_PutU16(p, detectTh);
+                }
+            }
+        }
+        break;
+
+        case TUNING_OP_WRITE_DETCONF:
+        case TUNING_OP_WRITE_FILTER: {
+            uint8_t size = (req->op == TUNING_OP_WRITE_DETCONF) ? TUNING_DETCONF_SIZE :
+                           TUNING_FILTER_SIZE;
+            const uint8_t *q = &pIn[2];
+
+            if (Tuning_CheckRange(req, size, 1U) != 0U) {
+                return TUNING_STATUS_BAD_PARAM;
+            }
+            for (i = pIn[0]; i < pIn[0] + pIn[1]; i++) {
+                TSI_WidgetTypeDef *pWidget = TSI_WidgetPointers[i];
+                TSI_DetectConfTypeDef *pConf = &pWidget->detConf;
+
+                if (req->op == TUNING_OP_WRITE_DETCONF) {
+                    pConf->activeTh = Tuning_GetU16(&q[0]);
+                    pConf->activeHys = Tuning_GetU16(&q[2]);
+                    pConf->noiseTh = Tuning_GetU16(&q[4]);
+                    pConf->negNoiseTh = Tuning_GetU16(&q[6]);
+                    pConf->onDebounce = q[8];
+                    pConf->offDebounce = q[9];
+                    pConf->bslnNegStopTimeout = Tuning_GetU16(&q[10]);
+#if ((TSI_SENSOR_BSLN_ALWAYS_UPDATE == 0U) && (TSI_SENSOR_BSLN_USE_LTA == 1U))
+                    pConf->ltaNegErrTh = Tuning_GetU16(&q[12]);
+                    pConf->ltaOnDebounce = q[14];
+                    pConf->ltaNegErrorDebounce = q[15];
+                    pConf->ltaActiveTimeout = Tuning_GetU16(&q[16]);
+                    pConf->ltaNormBslnStopTimeout = Tuning_GetU16(&q[18]);
+#endif
+                } else {
+                    pConf->bslnIIRCoeff = q[0];
+#if (TSI_PROX_FILTER_ADVIIR_EN == 1U)
+                    if (pWidget->meta->type == TSI_WIDGET_SELF_CAP_PROXIMITY) {
+                        TSI_SelfCapProximityTypeDef *pProx = (TSI_SelfCapProximityTypeDef *)pWidget;
+                        pProx->filterActiveTh = Tuning_GetU16(&q[1]);
+                        pProx->filterDetectTh = (int16_t)Tuning_GetU16(&q[3]);
+                    }
+#endif
+                }
+                q += size;
+            }
+        }
+        break;
+
+        case TUNING_OP_READ_ENABLE: {
+            uint32_t mask = 0U;
+
+            for (i = 0U; i < TSI_WIDGET_NUM; i++) {
+                if (TSI_WidgetPointers[i]->enable != 0U) {
+                    mask |= 1UL << i;
+                }
+            }
+            p = Tuning_PutU32(p, mask);
+        }
+        break;
+
+        case TUNING_OP_WRITE_ENABLE: {
+            uint32_t mask;
+            uint8_t running = (TSI_LibHandle.status == TSI_LIB_RUNNING) ? 1U : 0U;
+
+            if (req->len != 4U) {
+                return TUNING_STATUS_BAD_PARAM;
+            }
+            mask = (uint32_t)Tuning_GetU16(&pIn[0]) | ((uint32_t)Tuning_GetU16(&pIn[2]) << 16);
+            /* Enable commands need the library stopped, reconfig calibrates the new set */
+            jobNum = 0U;
+            if (running != 0U) {
+                jobSteps[jobNum].cmdCode = TSI_CMD_STOP;
+                jobSteps[jobNum++].param0 = 0U;
+            }
+            for (i = 0U; i < TSI_WIDGET_NUM; i++) {
+                uint8_t enable = (uint8_t)((mask >> i) & 1UL);
+
+                if (enable != (TSI_WidgetPointers[i]->enable != 0U ? 1U : 0U)) {
+                    jobSteps[jobNum].cmdCode = (enable != 0U) ? TSI_CMD_ENABLE_WIDGET :
+                                               TSI_CMD_DISABLE_WIDGET;
+                    jobSteps[jobNum++].param0 = i;
+                }
+            }
+            if (running != 0U) {
+                jobSteps[jobNum].cmdCode = TSI_CMD_START;
+                jobSteps[jobNum++].param0 = 0U;
+                jobSteps[jobNum].cmdCode = TSI_CMD_RECONFIG;
+                jobSteps[jobNum++].param0 = 0U;
+            }
+            for (i = 0U; i < jobNum; i++) {
+                jobSteps[i].param1 = 0U;
+            }
+            if (jobNum == 0U || (running != 0U && jobNum == 3U)) {
+                /* Mask unchanged */
+                jobNum = 0U;
+                break;
+            }
+        }
+        break;
+
+        case TUNING_OP_SUBSCRIBE:
+            if (req->len != 2U) {
+                return TUNING_STATUS_BAD_PARAM;
+            }
+            Telemetry_Subscribe(pIn[0], pIn[1]);
+            break;
+
+        case TUNING_OP_KEYFRAME:
+            if (req->len != 0U) {
+                return TUNING_STATUS_BAD_PARAM;
+            }
+            Telemetry_ForceKey();
+            break;
+
+        case TUNING_OP_READ_STATS: {
+            const TelemetryStatsTypeDef *pTelemetry = Telemetry_GetStats();
+
+            p = Tuning_PutU32(p, pTelemetry->frameCnt);
+            p = Tuning_PutU32(p, pTelemetry->sentCnt);
+            p = Tuning_PutU32(p, pTelemetry->droppedCnt);
+            p = Tuning_PutU32(p, pTelemetry->byteCnt);
+            *p++ = pTelemetry->channels;
+            *p++ = pTelemetry->decimation;
+            p = Tuning_PutU32(p, stats.requestCnt);
+            p = Tuning_PutU32(p, stats.crcErrorCnt);
+            p = Tuning_PutU32(p, stats.queueFullCnt);
+            p = Tuning_PutU32(p, stats.rxOverflowCnt);
+        }
+        break;
+
+        default:
+            return TUNING_STATUS_BAD_OP;
+    }
+
+    *pOutLen = (uint8_t)(p - pOut);
+    if (jobNum != 0U) {
+        jobIdx = 0U;
+        jobPosted = 0U;
+        return Tuning_RunJob();
+    }
+    return TUNING_STATUS_OK;
+}
+
+/*Step the mailbox job: post when the mailbox is free, collect when the library
+  wrote execStat back. The mailbox stays shared with the debugger and plugins*/
+static uint8_t Tuning_RunJob(void)
+{
+    TSI_LibHandleTypeDef *handle = &TSI_LibHandle;
+    const TuningStepTypeDef *pStep = &jobSteps[jobIdx];
+
+    if (jobPosted == 0U) {
+        if (handle->command.map.execStat != 0U) {
+            return TUNING_STATUS_PENDING;
+        }
+        handle->command.map.cmdCode = pStep->cmdCode;
+        handle->command.map.param0Hi = (uint8_t)(pStep->param0 >> 8);
+        handle->command.map.param0Lo = (uint8_t)pStep->param0;
+        handle->command.map.param1 = pStep->param1;
+        handle->command.map.execStat = 1U;
+        jobPosted = 1U;
+        return TUNING_STATUS_PENDING;
+    }
+
+    if (handle->command.map.execStat == 1U || handle->command.map.execStat == 2U) {
+        return TUNING_STATUS_PENDING;
+    }
+    jobExecStat = (uint8_t)handle->command.map.execStat;
+    jobResult = handle->command.map.result;
+    memcpy(jobExData, handle->command.map.exData, sizeof(jobExData));
+    if (jobExecStat == 3U) {
+        /* Release the mailbox, the error is reported in the response */
+        handle->command.map.execStat = 0U;
+        return TUNING_STATUS_TSI_ERROR;
+    }
+
+    jobPosted = 0U;
+    jobIdx++;
+    if (jobIdx < jobNum) {
+        return Tuning_RunJob();
+    }
+    return TUNING_STATUS_OK;
+}
+
+/*first, count and, for a write, the entries; returns 0 if valid*/
+static uint8_t Tuning_CheckRange(const TuningRequestTypeDef *req, uint8_t entrySize, uint8_t write)
+{
+    uint16_t expect;
+
+    if (req->len < 2U) {
+        return 1U;
+    }
+    if (req->payload[1] == 0U || (uint16_t)req->payload[0] + req->payload[1] > TSI_WIDGET_NUM) {
+        return 1U;
+    }
+    expect = (uint16_t)(2U + (uint16_t)req->payload[1] * entrySize);
+    if (expect > TUNING_PAYLOAD_MAX) {
+        return 1U;
+    }
+    return ((write != 0U) ? (req->len != expect) : (req->len != 2U)) ? 1U : 0U;
+}
+
+/*Frame the response in respBuf, its payload is already at respBuf[6]*/
+static void Tuning_Respond(const TuningRequestTypeDef *req, uint8_t status, uint8_t payloadLen)
+{
+    uint16_t crc;
+    uint16_t len = TUNING_HEADER_SIZE + 3U + payloadLen;
+
+    if (status != TUNING_STATUS_OK && status != TUNING_STATUS_TSI_ERROR) {
+        len = TUNING_HEADER_SIZE + 3U;
+    }
+    respBuf[0] = TELEMETRY_SYNC0;
+    respBuf[1] = TUNING_SYNC1;
+    respBuf[2] = (uint8_t)(len - TUNING_HEADER_SIZE);
+    respBuf[3] = req->tag;
+    respBuf[4] = (uint8_t)(req->op | TUNING_OP_RESPONSE);
+    respBuf[5] = status;
+    crc = TelemetryFrame_Crc16(&respBuf[2], (uint16_t)(len - 2U));
+    respBuf[len++] = (uint8_t)crc;
+    respBuf[len++] = (uint8_t)(crc >> 8);
+    respLen = len;
+}
+
+static uint8_t *Tuning_PutU16(uint8_t *p, uint16_t value)
+{
+    *p++ = (uint8_t)value;
+    *p++ = (uint8_t)(value >> 8);
+    return p;
+}
+
+static uint8_t *Tuning_PutU32(uint8_t *p, uint32_t value)
+{
+    p = Tuning_PutU16(p, (uint16_t)value);
+    return Tuning_PutU16(p, (uint16_t)(value >> 16));
+}
+
+static uint16_t Tuning_GetU16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+#endif  /* TUNING == 1 */
+
+/* =============================================  EOF  ============================================== */
@@ -0,0 +1,83 @@
+#ifndef __TUNING_H__
+#define __TUNING_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+/* ===========================================  Includes  =========================================== */
+#include <stdint.h>
+
+/* ============================================  Define  ============================================ */
+/* Tuning frame, both directions, on the telemetry UART (Tools/tuning_client.py):
+     [0]  0xA5, [1] 0xC3          sync, telemetry frames use 0xA5 0x5A
+     [2]  len                     bytes from tag to payload end
+     [3]  tag                     chosen by the host, echoed in the response
+     [4]  op                      TUNING_OP_x, response: op | TUNING_OP_RESPONSE
+     [5]  status                  response only, TUNING_STATUS_x
+     payload                      little-endian fields
+     crc16                        as telemetry frames, of [2] to payload end */
+#define TUNING_SYNC1                    (0xC3U)
+#define TUNING_OP_RESPONSE              (0x80U)
+
+/* Request payload limit, a response adds the status byte */
+#ifndef TUNING_PAYLOAD_MAX
+#define TUNING_PAYLOAD_MAX              (64U)
+#endif
+#define TUNING_FRAME_SIZE               (3U + 3U + TUNING_PAYLOAD_MAX + 2U)
+
+/* Operations. Widgets are addressed by index in TSI_WidgetPointers[], bulk
+   ones take first widget and count, then one entry per widget */
+#define TUNING_OP_INFO                  (0x00U)     /* -> version, widget num, sensor num, entry sizes, payload max */
+#define TUNING_OP_TSI_CMD               (0x01U)     /* cmdCode, param0 (u16), param1 -> execStat, result, exData[4] */
+#define TUNING_OP_READ_DETCONF          (0x10U)     /* first, count -> first, count, TUNING_DETCONF_SIZE each */
+#define TUNING_OP_WRITE_DETCONF         (0x11U)     /* first, count, entries */
+#define TUNING_OP_READ_FILTER           (0x12U)     /* first, count -> first, count, TUNING_FILTER_SIZE each */
+#define TUNING_OP_WRITE_FILTER          (0x13U)     /* first, count, entries */
+#define TUNING_OP_READ_ENABLE           (0x14U)     /* -> widget enable mask (u32) */
+#define TUNING_OP_WRITE_ENABLE          (0x15U)     /* mask (u32), library is stopped and reconfigured */
+#define TUNING_OP_SUBSCRIBE             (0x20U)     /* TELEMETRY_CH_x mask, decimation */
+#define TUNING_OP_READ_STATS            (0x21U)     /* -> TelemetryStatsTypeDef counters, tuning counters */
+#define TUNING_OP_KEYFRAME              (0x22U)     /* next sensor frame is a keyframe, sent on a broken delta chain */
+
+/* Response status */
+#define TUNING_STATUS_OK                (0x00U)
+#define TUNING_STATUS_BAD_OP            (0x01U)
+#define TUNING_STATUS_BAD_PARAM         (0x02U)
+#define TUNING_STATUS_TSI_ERROR         (0x03U)     /* Mailbox command returned execStat 3 */
+#define TUNING_STATUS_LPM               (0x04U)     /* Mailbox not served while the library is in LPM */
+
+/* detConf entry: activeTh, activeHys, noiseTh, negNoiseTh (u16), onDebounce,
+   offDebounce (u8), bslnNegStopTimeout (u16), then with LTA ltaNegErrTh (u16),
+   ltaOnDebounce, ltaNegErrorDebounce (u8), ltaActiveTimeout,
+   ltaNormBslnStopTimeout (u16). The size is reported by TUNING_OP_INFO */
+/* Filter entry: baseline IIR coefficient (u8), proximity ADVIIR filterActiveTh
+   (u16) and filterDetectTh (s16), zero and ignored for other widgets. Sensor
+   filter coefficients are build time TSI_NORM/PROX_FILTER_x */
+#define TUNING_FILTER_SIZE              (5U)
+
+/* ===========================================  Typedef  ============================================ */
+/* Protocol counters, appended to the TUNING_OP_READ_STATS response */
+typedef struct
+{
+    uint32_t requestCnt;        /* Valid requests queued */
+    uint32_t crcErrorCnt;
+    uint32_t queueFullCnt;      /* Requests dropped, the host times out and retries */
+    uint32_t rxOverflowCnt;     /* Bytes lost in the receive ring */
+} TuningStatsTypeDef;
+
+/* ==========================================  Variables  =========================================== */
+
+/* ====================================  Functions declaration  ===================================== */
+uint8_t Tuning_Init(void);
+void Tuning_Process(void);
+void Tuning_UartIrqHandler(void);
+const TuningStatsTypeDef *Tuning_GetStats(void);
+/* ======================================  Functions define  ======================================== */
+
+/* =============================================  EOF  ============================================== */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif  /* __cplusplus */
+
+#endif
@@ -187,4 +187,5 @@ TSI_PLUGIN(CommNoise, TSI_PLUGIN_PRIORITY)
     NULL,                               /* widgetStatusUpdated */
     NULL,                               /* getInitScanBufferAndCount */
     NULL,                               /* processInitScanValue */
+    NULL,                               /* processInitScanSample */
 };
@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include "tsi_object.h"
 #include "tsi_processing.h"
 #include "tsi_driver.h"
@@ -6,7 +8,7 @@
 
 /* Configurations -----------------------------------------------------------*/
 /** Plugin version string. */
-#define TSI_PLUGIN_VERSION                  "v1.1"
+#define TSI_PLUGIN_VERSION                  "v1.3"
 
 /* USER CONFIGURATION BEGIN */
 /** Plugin call priority(0-7). Lower value means higher priority. */
@@ -23,29 +25,316 @@
 
 /** Init by median value. */
 #define TSI_INIT_MED                        (0U)
+
+/**
+ * Use streaming statistics instead of init scan buffer. Only O(1) state is
+ * kept for each sensor:
+ *
+ * * TSI_INIT_MAX: running maximum,
+ * * TSI_INIT_AVR: running sum,
+ * * TSI_INIT_MED: approximate median(remedian with base 3). Samples left in
+ *   lower levels are folded in by weight, so any TSI_INIT_TIME is used.
+ */
+#define TSI_INIT_STREAMING                  (1U)
+
+/**
+ * Borrow init memory by TSI_ScratchAcquireCallback() instead of static
+ * buffers: the init scan buffer, or the streaming statistics when
+ * TSI_INIT_STREAMING is 1. If the borrow is refused, widget is inited by a
+ * single scan.
+ */
+#define TSI_INIT_SHARED_SCRATCH             (1U)
 /* USER CONFIGURATION END */
 /* Defines ------------------------------------------------------------------*/
+#if (TSI_INIT_STREAMING == 1U)
+/** Remedian base(window size of each level). */
+#define TSI_INIT_MED_BASE                   (3U)
+
+/**
+ * Remedian levels. An element of level n stands for TSI_INIT_MED_BASE ^ n
+ * samples. The result is the weighted median of all level elements, an
+ * approximation of the sample median even for TSI_INIT_MED_BASE ^
+ * TSI_INIT_MED_LEVELS samples.
+ */
+#define TSI_INIT_MED_LEVELS                 (2U)
+
+/** Streaming init statistics of one sensor. */
+typedef struct _TSI_InitStat {
+#if (TSI_INIT_MAX != 0U)
+    /** Running maximum. */
+    uint16_t max[TSI_TOTAL_SCAN_NUM];
+#elif (TSI_INIT_AVR != 0U)
+    /** Running sum. */
+    uint32_t sum[TSI_TOTAL_SCAN_NUM];
+#elif (TSI_INIT_MED != 0U)
+    /** Remedian level buffers. */
+    uint16_t level[TSI_INIT_MED_LEVELS][TSI_INIT_MED_BASE][TSI_TOTAL_SCAN_NUM];
+
+    /** Remedian level buffer counts. */
+    uint8_t levelCnt[TSI_INIT_MED_LEVELS];
+
+    /** Sample weights of top level elements, they absorb reduced medians. */
+    uint16_t topWeight[TSI_INIT_MED_BASE];
+#endif
+    /** Sample count. */
+    uint8_t count;
+} TSI_InitStatTypeDef;
+#endif  /* TSI_INIT_STREAMING == 1U */
 
 /* Function prototypes ------------------------------------------------------*/
+#if (TSI_INIT_STREAMING == 1U)
+#if (TSI_INIT_MED != 0U)
+    static uint16_t getMedian3(uint16_t a, uint16_t b, uint16_t c);
+    static void pushRemedian(TSI_InitStatTypeDef *stat, uint8_t level, const uint16_t *pSample);
+    static uint16_t getRemedian(const TSI_InitStatTypeDef *stat, uint32_t freq);
+#endif
+#else
 #if TSI_INIT_MED
     static uint16_t getMedian(int *arr, int length);
 #endif
+#endif  /* TSI_INIT_STREAMING == 1U */
 /* Variables ----------------------------------------------------------------*/
+#if (TSI_INIT_STREAMING == 1U)
+/**
+ * Self-cap sensors are initialized one by one and use the first slot.
+ * Mutual-cap widget sensors are scanned together and use slot of their index.
+ */
+#if (TSI_INIT_SHARED_SCRATCH == 1U)
+/* Point to borrowed scratch memory during widget init */
+static TSI_InitStatTypeDef *initStat = NULL;
+#else
+static TSI_InitStatTypeDef initStat[TSI_MAX_SCANGROUP_SENSOR_NUM];
+#endif  /* TSI_INIT_SHARED_SCRATCH == 1U */
+#elif (TSI_INIT_SHARED_SCRATCH == 1U)
+/* Point to borrowed scratch memory during widget init */
+static uint16_t *scanBuffer = NULL;
+static uint16_t *mutualBuffer = NULL;
+#else
 static uint16_t scanBuffer[TSI_INIT_TIME * TSI_TOTAL_SCAN_NUM];
 static uint16_t mutualBuffer[TSI_INIT_TIME * TSI_MAX_SCANGROUP_SENSOR_NUM * TSI_TOTAL_SCAN_NUM];
+#endif  /* TSI_INIT_STREAMING == 1U */
 
 /* Function implementations -------------------------------------------------*/
+#if (TSI_INIT_STREAMING == 1U)
+static TSI_InitStatTypeDef *TSI_GetInitStat(TSI_WidgetTypeDef *widget, TSI_SensorTypeDef *sensor)
+{
+    uint32_t slot = 0U;
+    if(TSI_WIDGET_IS_MUTUAL_CAP(widget)) {
+        slot = (uint32_t)(sensor - widget->meta->sensors);
+    }
+    TSI_ASSERT(slot < TSI_MAX_SCANGROUP_SENSOR_NUM);
+    return &initStat[slot];
+}
+
+static uint32_t TSI_GetInitScanBufferAndCountCallback(TSI_LibHandleTypeDef *handle,
+        TSI_WidgetTypeDef *widget, TSI_SensorTypeDef *sensor, uint16_t **ppBuffer)
+{
+    TSI_UNUSED(sensor)
+    if(TSI_WIDGET_IS_SELF_CAP(widget) || TSI_WIDGET_IS_MUTUAL_CAP(widget)) {
+#if (TSI_INIT_SHARED_SCRATCH == 1U)
+        initStat = (TSI_InitStatTypeDef *)TSI_ScratchAcquireCallback(handle,
+                   TSI_MAX_SCANGROUP_SENSOR_NUM * sizeof(TSI_InitStatTypeDef));
+        if(initStat == NULL) {
+            /* Refused: single scan. */
+            return 0U;
+        }
+#else
+        TSI_UNUSED(handle)
+#endif  /* TSI_INIT_SHARED_SCRATCH == 1U */
+        /* No buffer: samples are passed by processInitScanSample. */
+        *ppBuffer = NULL;
+        return TSI_INIT_TIME;
+    }
+    return 0U;
+}
+
+static void TSI_ProcessInitScanSampleCallback(TSI_LibHandleTypeDef *handle,
+        TSI_WidgetTypeDef *widget, TSI_SensorTypeDef *sensor,
+        uint32_t sampleIdx, const uint16_t *pSample)
+{
+    TSI_InitStatTypeDef *stat = TSI_GetInitStat(widget, sensor);
+    uint32_t freq;
+    TSI_UNUSED(handle)
+
+    if(sampleIdx == 0U) {
+        memset(stat, 0, sizeof(TSI_InitStatTypeDef));
+    }
+    stat->count++;
+
+#if (TSI_INIT_MAX != 0U)
+    for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+        if(stat->max[freq] < pSample[freq]) {
+            stat->max[freq] = pSample[freq];
+        }
+    }
+#elif (TSI_INIT_AVR != 0U)
+    for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+        stat->sum[freq] += pSample[freq];
+    }
+#elif (TSI_INIT_MED != 0U)
+    TSI_UNUSED(freq)
+    pushRemedian(stat, 0U, pSample);
+#else
+    TSI_UNUSED(freq)
+    TSI_UNUSED(pSample)
+#endif
+}
+
+static void TSI_ProcessInitScanValueCallback(TSI_LibHandleTypeDef *handle,
+        TSI_WidgetTypeDef *widget, TSI_SensorTypeDef *sensor, uint16_t *pValueBuffer)
+{
+    TSI_InitStatTypeDef *stat = TSI_GetInitStat(widget, sensor);
+    uint32_t freq;
+    TSI_UNUSED(handle)
+
+    if(stat->count == 0U) {
+        /* No sample. Use last scan value. */
+        for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+            pValueBuffer[freq] = sensor->rawCount[freq];
+        }
+        return;
+    }
+
+#if (TSI_INIT_MAX != 0U)
+    for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+        pValueBuffer[freq] = stat->max[freq];
+    }
+#elif (TSI_INIT_AVR != 0U)
+    for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+        pValueBuffer[freq] = (uint16_t)(stat->sum[freq] / stat->count);
+    }
+#elif (TSI_INIT_MED != 0U)
+    for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+        pValueBuffer[freq] = getRemedian(stat, freq);
+    }
+#endif
+}
+
+#if (TSI_INIT_MED != 0U)
+static uint16_t getMedian3(uint16_t a, uint16_t b, uint16_t c)
+{
+    if(a > b) {
+        uint16_t t = a;
+        a = b;
+        b = t;
+    }
+    /* a <= b */
+    if(c <= a) {
+        return a;
+    }
+    if(c >= b) {
+        return b;
+    }
+    return c;
+}
+
+static void pushRemedian(TSI_InitStatTypeDef *stat, uint8_t level, const uint16_t *pSample)
+{
+    uint16_t med[TSI_TOTAL_SCAN_NUM];
+    uint8_t cnt = stat->levelCnt[level];
+    uint32_t freq;
+
+    for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+        stat->level[level][cnt][freq] = pSample[freq];
+    }
+    if((level + 1U) == TSI_INIT_MED_LEVELS) {
+        uint16_t weight = 1U;
+        uint8_t lvl;
+        for(lvl = 0U; lvl < level; lvl++) {
+            weight *= TSI_INIT_MED_BASE;
+        }
+        stat->topWeight[cnt] = weight;
+    }
+    if(++cnt < TSI_INIT_MED_BASE) {
+        stat->levelCnt[level] = cnt;
+        return;
+    }
+
+    /* Level is full: reduce to its median */
+    for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+        med[freq] = getMedian3(stat->level[level][0][freq],
+                               stat->level[level][1][freq],
+                               stat->level[level][2][freq]);
+    }
+    if((level + 1U) < TSI_INIT_MED_LEVELS) {
+        /* Pass median to next level */
+        stat->levelCnt[level] = 0U;
+        pushRemedian(stat, level + 1U, med);
+    }
+    else {
+        /* Top level: keep median as the only element, weighing all its samples */
+        for(freq = 0U; freq < TSI_TOTAL_SCAN_NUM; freq++) {
+            stat->level[level][0][freq] = med[freq];
+        }
+        for(cnt = 1U; cnt < TSI_INIT_MED_BASE; cnt++) {
+            stat->topWeight[0] += stat->topWeight[cnt];
+        }
+        stat->levelCnt[level] = 1U;
+    }
+}
+
+static uint16_t getRemedian(const TSI_InitStatTypeDef *stat, uint32_t freq)
+{
+    uint16_t value[TSI_INIT_MED_LEVELS * TSI_INIT_MED_BASE];
+    uint16_t weight[TSI_INIT_MED_LEVELS * TSI_INIT_MED_BASE];
+    uint16_t levelWeight = 1U;
+    uint32_t n = 0U;
+    uint32_t acc = 0U;
+    uint32_t lvl, i, j;
+
+    /* Collect elements of all levels sorted by value, partial levels included */
+    for(lvl = 0U; lvl < TSI_INIT_MED_LEVELS; lvl++) {
+        for(i = 0U; i < stat->levelCnt[lvl]; i++) {
+            uint16_t v = stat->level[lvl][i][freq];
+            for(j = n; (j > 0U) && (value[j - 1U] > v); j--) {
+                value[j] = value[j - 1U];
+                weight[j] = weight[j - 1U];
+            }
+            value[j] = v;
+            weight[j] = ((lvl + 1U) == TSI_INIT_MED_LEVELS) ? stat->topWeight[i] : levelWeight;
+            n++;
+        }
+        levelWeight *= TSI_INIT_MED_BASE;
+    }
+
+    /* Weighted median: weights sum up to the sample count */
+    for(i = 0U; i < n; i++) {
+        acc += weight[i];
+        if((acc * 2U) >= stat->count) {
+            break;
+        }
+    }
+    return value[(i < n) ? i : (n - 1U)];
+}
+#endif  /* TSI_INIT_MED != 0U */
+
+#else
 static uint32_t TSI_GetInitScanBufferAndCountCallback(TSI_LibHandleTypeDef *handle,
         TSI_WidgetTypeDef *widget, TSI_SensorTypeDef *sensor, uint16_t **ppBuffer)
 {
+#if (TSI_INIT_SHARED_SCRATCH == 1U)
     if(TSI_WIDGET_IS_SELF_CAP(widget)) {
+        scanBuffer = (uint16_t *)TSI_ScratchAcquireCallback(handle,
+                     TSI_INIT_TIME * TSI_TOTAL_SCAN_NUM * sizeof(uint16_t));
         *ppBuffer = scanBuffer;
         return TSI_INIT_TIME;
     }
     else if(TSI_WIDGET_IS_MUTUAL_CAP(widget)) {
+        mutualBuffer = (uint16_t *)TSI_ScratchAcquireCallback(handle,
+                       TSI_INIT_TIME * TSI_MAX_SCANGROUP_SENSOR_NUM * TSI_TOTAL_SCAN_NUM * sizeof(uint16_t));
         *ppBuffer = mutualBuffer;
         return TSI_INIT_TIME;
     }
+#else
+    if(TSI_WIDGET_IS_SELF_CAP(widget)) {
+        *ppBuffer = scanBuffer;
+        return TSI_INIT_TIME;
+    }
+    else if(TSI_WIDGET_IS_MUTUAL_CAP(widget)) {
+        *ppBuffer = mutualBuffer;
+        return TSI_INIT_TIME;
+    }
+#endif  /* TSI_INIT_SHARED_SCRATCH == 1U */
     else {
         /* Do nothing. */
     }
@@ -161,6 +450,7 @@ static uint16_t getMedian(int *arr, int length)
     return median;
 }
 #endif
+#endif  /* TSI_INIT_STREAMING == 1U */
 
 /* Plugin registration ------------------------------------------------------*/
 TSI_PLUGIN(WidgetInit, TSI_PLUGIN_PRIORITY)
@@ -175,4 +465,9 @@ TSI_PLUGIN(WidgetInit, TSI_PLUGIN_PRIORITY)
     NULL,                                   /* widgetStatusUpdated */
     TSI_GetInitScanBufferAndCountCallback,  /* getInitScanBufferAndCount */
     TSI_ProcessInitScanValueCallback,       /* processInitScanValue */
+#if (TSI_INIT_STREAMING == 1U)
+    TSI_ProcessInitScanSampleCallback,      /* processInitScanSample */
+#else
+    NULL,                                   /* processInitScanSample */
+#endif
 };
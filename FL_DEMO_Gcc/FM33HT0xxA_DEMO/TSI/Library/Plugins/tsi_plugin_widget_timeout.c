@@ -110,4 +110,5 @@ TSI_PLUGIN(WidgetTimeout, TSI_PLUGIN_PRIORITY)
     TSI_Widget_StatusUpdateCallback,    /* widgetStatusUpdated */
     NULL,                               /* getInitScanBufferAndCount */
     NULL,                               /* processInitScanValue */
+    NULL,                               /* processInitScanSample */
 };
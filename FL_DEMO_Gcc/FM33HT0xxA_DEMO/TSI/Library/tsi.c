@@ -11,6 +11,15 @@ TSI_STATIC TSI_RetCode TSI_ScanAndInitSelfCapWidget(TSI_LibHandleTypeDef *handle
         TSI_SelfCapWidgetTypeDef *scWidget);
 TSI_STATIC TSI_RetCode TSI_ScanAndInitMutualCapWidget(TSI_LibHandleTypeDef *handle,
         TSI_MutualCapWidgetTypeDef *mcWidget);
+#if ((TSI_ADAPTIVE_SCAN_RATE == 1U) || (TSI_SCAN_GROUP_SCHEDULE == 1U))
+TSI_STATIC bool TSI_IsAnyWidgetActive(TSI_LibHandleTypeDef *handle);
+#endif  /* (TSI_ADAPTIVE_SCAN_RATE == 1U) || (TSI_SCAN_GROUP_SCHEDULE == 1U) */
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+TSI_STATIC bool TSI_UpdateScanRate(TSI_LibHandleTypeDef *handle);
+#endif  /* TSI_ADAPTIVE_SCAN_RATE == 1U */
+#if ((TSI_USED_IN_LPM_MODE == 1U) && (TSI_LPM_WAKE_ON_TOUCH == 1U))
+TSI_STATIC TSI_RetCode TSI_LPMWakeScan(TSI_LibHandleTypeDef *handle, bool *isTouched);
+#endif  /* (TSI_USED_IN_LPM_MODE == 1U) && (TSI_LPM_WAKE_ON_TOUCH == 1U) */
 
 /* API implementations ------------------------------------------------------*/
 #ifdef TSI_NO_RAM_INIT
@@ -140,6 +149,10 @@ TSI_RetCode TSI_Start(TSI_LibHandleTypeDef *handle)
     /* Start scan interval timer */
     TSI_StartTimer(handle->scanIntvTimer);
 #endif
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+    /* Restart idle time counting */
+    handle->lastActiveTick = TSI_GetTick(handle);
+#endif
 
     /* Update status */
     handle->status = TSI_LIB_RUNNING;
@@ -216,6 +229,10 @@ TSI_RetCode TSI_Resume(TSI_LibHandleTypeDef *handle)
     /* Start scan interval timer */
     TSI_StartTimer(handle->scanIntvTimer);
 #endif
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+    /* Restart idle time counting */
+    handle->lastActiveTick = TSI_GetTick(handle);
+#endif
 
     /* Update status and return */
     handle->status = TSI_LIB_RUNNING;
@@ -264,6 +281,9 @@ TSI_RetCode TSI_ScanAndInitWidget(TSI_LibHandleTypeDef *handle,
     handle->driver->scanGroupNum = groupNum;
     handle->driver->forceReConf = 1U;
 
+    /* Return borrowed init scratch memory, also on failure */
+    TSI_ScratchReleaseCallback(handle);
+
     return res;
 }
 
@@ -283,6 +303,10 @@ TSI_RetCode TSI_ScanAndInitAllWidgets(TSI_LibHandleTypeDef *handle)
 
 void TSI_Handler(TSI_LibHandleTypeDef *handle)
 {
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+    bool isLPMRequested = false;
+#endif  /* TSI_ADAPTIVE_SCAN_RATE == 1U */
+
     /* Library should be in running mode. */
     if(handle->status == TSI_LIB_RUNNING) {
 #if (TSI_USED_IN_LPM_MODE == 1U)
@@ -302,6 +326,16 @@ void TSI_Handler(TSI_LibHandleTypeDef *handle)
             /* Call user callback */
             TSI_WidgetUpdateCpltCallback(handle);
 
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+            /* Scan all groups every frame while any widget is active */
+            TSI_Drv_SetFullRate(handle->driver, TSI_IsAnyWidgetActive(handle) ? 1U : 0U);
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+            /* Adjust scan period by widget activity */
+            isLPMRequested = TSI_UpdateScanRate(handle);
+#endif  /* TSI_ADAPTIVE_SCAN_RATE == 1U */
+
 #if ((TSI_USE_TIMEBASE == 0U) || ((TSI_USE_TIMEBASE == 1U) && (TSI_SCAN_USE_TIMEBASE == 0U)))
             /* Start next scan. If any error occurred, driver will
             stop scan and set error flag(s), which will be
@@ -348,6 +382,13 @@ void TSI_Handler(TSI_LibHandleTypeDef *handle)
 
     /* Handle command. */
     TSI_HandleCommand(handle);
+
+#if ((TSI_ADAPTIVE_SCAN_RATE == 1U) && (TSI_USED_IN_LPM_MODE == 1U))
+    if(isLPMRequested && handle->status == TSI_LIB_RUNNING) {
+        /* Idle for a long time: enter LPM mode. */
+        TSI_EnterLPM(handle);
+    }
+#endif  /* (TSI_ADAPTIVE_SCAN_RATE == 1U) && (TSI_USED_IN_LPM_MODE == 1U) */
 }
 
 #if (TSI_USE_TIMEBASE == 1U)
@@ -406,6 +447,11 @@ void TSI_LeaveLPM(TSI_LibHandleTypeDef *handle)
     /* Recover TSI instance from LPM mode */
     TSI_Dev_LeaveLPM(handle->driver);
 
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    /* Groups skipped in LPM are all due in the first frame */
+    TSI_Drv_SetFullRate(handle->driver, 1U);
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+
     if(handle->status == TSI_LIB_RUNNING) {
         /* Start scan */
 #if (!((TSI_USE_DMA == 1U) && (TSI_DEV_SUPPORT_DMA == 1U)))
@@ -418,6 +464,10 @@ void TSI_LeaveLPM(TSI_LibHandleTypeDef *handle)
     /* Start scan interval timer */
     TSI_StartTimer(handle->scanIntvTimer);
 #endif
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+    /* Restart idle time counting */
+    handle->lastActiveTick = TSI_GetTick(handle);
+#endif
 
     /* Clear LPM flag. */
     handle->isLPM = 0U;
@@ -437,6 +487,37 @@ void TSI_LPMBlockHandler(TSI_LibHandleTypeDef *handle)
         /* Device recover from LPM mode */
         TSI_Dev_LeaveLPM(handle->driver);
 
+#if (TSI_LPM_WAKE_ON_TOUCH == 1U)
+        {
+            bool isTouched = false;
+
+            /* Scan wake scan group only */
+            if(TSI_LPMWakeScan(handle, &isTouched) != TSI_PASS) {
+                return;
+            }
+            handle->lpmStat.wakeScanCnt++;
+            if(isTouched) {
+                handle->lpmStat.wakeCnt++;
+            }
+            else if((TSI_LPM_WAKE_REFRESH_NUM == 0U) ||
+                    (++handle->lpmStat.idleScanCnt < TSI_LPM_WAKE_REFRESH_NUM)) {
+                /* Not touched: skip full scan and processing */
+                TSI_Dev_EnterLPM(handle->driver);
+                return;
+            }
+            else {
+                /* Refresh baselines */
+            }
+            handle->lpmStat.idleScanCnt = 0U;
+            handle->lpmStat.fullScanCnt++;
+        }
+#endif  /* TSI_LPM_WAKE_ON_TOUCH == 1U */
+
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+        /* Full scan covers every enabled group */
+        TSI_Drv_SetFullRate(handle->driver, 1U);
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+
         /* Perform scan */
         for(i = 0; i < TSI_LPM_SCAN_NUM; i++) {
             if(TSI_Drv_StartScan(handle->driver, TSI_DRV_SCAN_MODE_BLOCKING, 1U) != TSI_PASS) {
@@ -452,6 +533,14 @@ void TSI_LPMBlockHandler(TSI_LibHandleTypeDef *handle)
 
         /* Call user callback */
         TSI_WidgetUpdateCpltCallback(handle);
+
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+        if(TSI_IsAnyWidgetActive(handle)) {
+            /* Widget active: leave LPM mode and scan with active period. */
+            TSI_SetTimerPeriod(handle->scanIntvTimer, TSI_SCAN_PERIOD_TICK);
+            TSI_LeaveLPM(handle);
+        }
+#endif  /* TSI_ADAPTIVE_SCAN_RATE == 1U */
     }
 }
 #endif  /* TSI_USED_IN_LPM_MODE == 1U */
@@ -680,6 +769,10 @@ TSI_STATIC void TSI_HandleCommand(TSI_LibHandleTypeDef *handle)
                     execStat = 3U;
                     break;
                 }
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+                /* Update every widget, not only the last frame's groups */
+                handle->driver->cpltMask = 0xFFFFFFFFUL;
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
                 TSI_Widget_UpdateAll(handle);
                 execStat = 0U;
                 break;
@@ -807,8 +900,15 @@ TSI_STATIC void TSI_HandleCommand(TSI_LibHandleTypeDef *handle)
             break;
 
             default:
-                /* No such command. */
-                execStat = 3U;
+                if(cmdCode >= TSI_CMD_USER_BASE) {
+                    /* Application command, may use exData. */
+                    execStat = TSI_UserCommandCallback(handle, cmdCode, param0,
+                                                       param1, &result);
+                }
+                else {
+                    /* No such command. */
+                    execStat = 3U;
+                }
                 break;
         }
         /* Write back */
@@ -907,7 +1007,8 @@ TSI_STATIC TSI_RetCode TSI_ScanAndInitSelfCapWidget(TSI_LibHandleTypeDef *handle
         if(handle->cb.getInitScanBufferAndCount != NULL) {
             scanCnt = handle->cb.getInitScanBufferAndCount(handle, widget, pSensor,
                       &scanBuffer);
-            if(scanCnt == 0U || scanBuffer == NULL) {
+            if(scanCnt == 0U ||
+                    (scanBuffer == NULL && handle->cb.processInitScanSample == NULL)) {
                 /* Invalid scan params. */
                 scanCnt = 1U;
             }
@@ -923,13 +1024,21 @@ TSI_STATIC TSI_RetCode TSI_ScanAndInitSelfCapWidget(TSI_LibHandleTypeDef *handle
             /* Bypass filter */
             TSI_Filter_Bypass(pSensor);
             /* Fill buffer */
-            if(scanCnt > 1U) {
+            if(scanCnt > 1U && scanBuffer != NULL) {
                 int index = i * TSI_TOTAL_SCAN_NUM;
                 int j;
                 for(j = 0; j < TSI_TOTAL_SCAN_NUM; j++) {
                     scanBuffer[index + j] = pSensor->rawCount[j];
                 }
             }
+            else if(scanCnt > 1U) {
+                /* Streaming mode: pass sample to user directly */
+                handle->cb.processInitScanSample(handle, widget, pSensor, i,
+                                                 pSensor->rawCount);
+            }
+            else {
+                /* Do nothing */
+            }
         }
 
         if(scanCnt > 1U) {
@@ -939,12 +1048,17 @@ TSI_STATIC TSI_RetCode TSI_ScanAndInitSelfCapWidget(TSI_LibHandleTypeDef *handle
             if(handle->cb.processInitScanValue != NULL) {
                 handle->cb.processInitScanValue(handle, widget, pSensor, valBuffer);
             }
-            else {
+            else if(scanBuffer != NULL) {
                 int index = (scanCnt - 1U) * TSI_TOTAL_SCAN_NUM;
                 for(j = 0; j < TSI_TOTAL_SCAN_NUM; j++) {
                     valBuffer[j] = scanBuffer[index + j];
                 }
             }
+            else {
+                for(j = 0; j < TSI_TOTAL_SCAN_NUM; j++) {
+                    valBuffer[j] = pSensor->rawCount[j];
+                }
+            }
 #if (!(TSI_NORM_FILTER_EN || TSI_PROX_FILTER_EN))
             /* Set valueBuffer to rawCount. */
             for(j = 0; j < TSI_TOTAL_SCAN_NUM; j++) {
@@ -992,7 +1106,8 @@ TSI_STATIC TSI_RetCode TSI_ScanAndInitMutualCapWidget(TSI_LibHandleTypeDef *hand
     /* Call user handler to get buffer pointer and scan count */
     if(handle->cb.getInitScanBufferAndCount != NULL) {
         scanCnt = handle->cb.getInitScanBufferAndCount(handle, widget, NULL, &scanBuffer);
-        if(scanCnt == 0U || scanBuffer == NULL) {
+        if(scanCnt == 0U ||
+                (scanBuffer == NULL && handle->cb.processInitScanSample == NULL)) {
             /* Invalid scan params. */
             scanCnt = 1U;
         }
@@ -1011,13 +1126,21 @@ TSI_STATIC TSI_RetCode TSI_ScanAndInitMutualCapWidget(TSI_LibHandleTypeDef *hand
             /* Bypass filter */
             TSI_Filter_Bypass(pSensor);
             /* Fill buffer */
-            if(scanCnt > 1U) {
+            if(scanCnt > 1U && scanBuffer != NULL) {
                 int index = index0 + (idx * TSI_TOTAL_SCAN_NUM);
                 int j;
                 for(j = 0; j < TSI_TOTAL_SCAN_NUM; j++) {
                     scanBuffer[index + j] = pSensor->rawCount[j];
                 }
             }
+            else if(scanCnt > 1U) {
+                /* Streaming mode: pass sample to user directly */
+                handle->cb.processInitScanSample(handle, widget, pSensor, i,
+                                                 pSensor->rawCount);
+            }
+            else {
+                /* Do nothing */
+            }
         }
         TSI_FOREACH_END()
     }
@@ -1031,12 +1154,17 @@ TSI_STATIC TSI_RetCode TSI_ScanAndInitMutualCapWidget(TSI_LibHandleTypeDef *hand
             if(handle->cb.processInitScanValue != NULL) {
                 handle->cb.processInitScanValue(handle, widget, pSensor, valBuffer);
             }
-            else {
+            else if(scanBuffer != NULL) {
                 int index = index0 + (idx * TSI_TOTAL_SCAN_NUM);
                 for(i = 0; i < TSI_TOTAL_SCAN_NUM; i++) {
                     valBuffer[i] = scanBuffer[index + i];
                 }
             }
+            else {
+                for(i = 0; i < TSI_TOTAL_SCAN_NUM; i++) {
+                    valBuffer[i] = pSensor->rawCount[i];
+                }
+            }
 #if (!(TSI_NORM_FILTER_EN || TSI_PROX_FILTER_EN))
             /* Set valueBuffer to rawCount. */
             for(i = 0; i < TSI_TOTAL_SCAN_NUM; i++) {
@@ -1117,3 +1245,153 @@ TSI_WEAK void TSI_ScanErrorCallback(TSI_LibHandleTypeDef *handle)
     while(1)
     {}
 }
+
+TSI_WEAK void *TSI_ScratchAcquireCallback(TSI_LibHandleTypeDef *handle, uint32_t size)
+{
+    TSI_UNUSED(handle)
+    TSI_UNUSED(size)
+
+    /* Plugins borrow init scan buffers here, so that the application can
+       share one region between TSI init and other phases. Repeated calls
+       during one widget init shall return the same region. Return NULL to
+       refuse, then init falls back to single scan. */
+    /* Default: No scratch memory. */
+    return NULL;
+}
+
+TSI_WEAK void TSI_ScratchReleaseCallback(TSI_LibHandleTypeDef *handle)
+{
+    TSI_UNUSED(handle)
+
+    /* Called after each widget init, scratch memory is no longer used. */
+    /* Default: Do nothing. */
+}
+
+TSI_WEAK uint8_t TSI_UserCommandCallback(TSI_LibHandleTypeDef *handle, uint8_t cmdCode,
+        uint16_t param0, uint8_t param1, uint8_t *result)
+{
+    TSI_UNUSED(handle)
+    TSI_UNUSED(cmdCode)
+    TSI_UNUSED(param0)
+    TSI_UNUSED(param1)
+    TSI_UNUSED(result)
+
+    /* Return command execution status, 0 when done, 3 on error. */
+    /* Default: No application command. */
+    return 3U;
+}
+
+#if ((TSI_USED_IN_LPM_MODE == 1U) && (TSI_LPM_WAKE_ON_TOUCH == 1U))
+TSI_STATIC TSI_RetCode TSI_LPMWakeScan(TSI_LibHandleTypeDef *handle, bool *isTouched)
+{
+    TSI_DriverTypeDef *drv = handle->driver;
+    TSI_ScanGroupTypeDef *scanGroups = drv->scanGroups;
+    uint8_t scanGroupNum = drv->scanGroupNum;
+    uint8_t scanGroupIdx = drv->scanGroupIdx;
+    uint8_t oldScanGroupIdx = drv->oldScanGroupIdx;
+    TSI_ScanGroupTypeDef *wakeGroup;
+    TSI_SensorTypeDef *sensor;
+    TSI_DetectConfTypeDef *detConf;
+    int32_t diffCount;
+    TSI_RetCode res = TSI_PASS;
+    int i;
+
+    TSI_ASSERT(TSI_LPM_WAKE_SCAN_GROUP < scanGroupNum);
+    wakeGroup = &scanGroups[TSI_LPM_WAKE_SCAN_GROUP];
+    TSI_ASSERT(wakeGroup->type == TSI_SCAN_GROUP_SELF_CAP_PARALLEL);
+
+    /* Switch to wake scan group */
+    drv->scanGroups = wakeGroup;
+    drv->scanGroupNum = 1U;
+    drv->forceReConf = 1U;
+
+    /* Perform scan */
+    for(i = 0; i < TSI_LPM_SCAN_NUM; i++) {
+        res = TSI_Drv_StartScan(drv, TSI_DRV_SCAN_MODE_BLOCKING, 1U);
+        if(res != TSI_PASS) {
+            break;
+        }
+    }
+
+    /* Restore scan groups */
+    drv->scanGroups = scanGroups;
+    drv->scanGroupNum = scanGroupNum;
+    drv->scanGroupIdx = scanGroupIdx;
+    drv->oldScanGroupIdx = oldScanGroupIdx;
+    drv->forceReConf = 1U;
+    if(res != TSI_PASS) {
+        return res;
+    }
+
+    /* Compare unfiltered value of the ganged sensor with its baseline */
+    sensor = TSI_SensorPointers[wakeGroup->sensors[0U]];
+    detConf = sensor->meta->detConf;
+    if(detConf == NULL) {
+        detConf = &sensor->meta->parent->detConf;
+    }
+#if (TSI_NORM_FILTER_EN || TSI_PROX_FILTER_EN)
+    diffCount = (int32_t)sensor->bslnVar.sensorBuffer[0U] - (int32_t)sensor->baseline[0U];
+#else
+    diffCount = (int32_t)sensor->rawCount[0U] - (int32_t)sensor->baseline[0U];
+#endif  /* TSI_NORM_FILTER_EN || TSI_PROX_FILTER_EN */
+    if(TSI_LPM_WAKE_TH != 0U) {
+        *isTouched = (diffCount > (int32_t)TSI_LPM_WAKE_TH);
+    }
+    else {
+        *isTouched = (diffCount > (int32_t)detConf->noiseTh);
+    }
+
+    return TSI_PASS;
+}
+#endif  /* (TSI_USED_IN_LPM_MODE == 1U) && (TSI_LPM_WAKE_ON_TOUCH == 1U) */
+
+#if ((TSI_ADAPTIVE_SCAN_RATE == 1U) || (TSI_SCAN_GROUP_SCHEDULE == 1U))
+TSI_STATIC bool TSI_IsAnyWidgetActive(TSI_LibHandleTypeDef *handle)
+{
+    TSI_FOREACH_OBJ(TSI_WidgetTypeDef **, ppWidget, handle->widgets,
+                    handle->widgetNum) {
+        TSI_WidgetTypeDef *widget = *ppWidget;
+        if(widget->enable != TSI_WIDGET_ENABLE) {
+            continue;
+        }
+        if(widget->status != 0U) {
+            return true;
+        }
+        if(widget->meta->type == TSI_WIDGET_SELF_CAP_PROXIMITY &&
+                widget->meta->sensors[0U].diffCount > 0) {
+            /* Proximity approaching: react before widget becomes active. */
+            return true;
+        }
+    }
+    TSI_FOREACH_END()
+
+    return false;
+}
+#endif  /* (TSI_ADAPTIVE_SCAN_RATE == 1U) || (TSI_SCAN_GROUP_SCHEDULE == 1U) */
+
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+/* Returns true if library should enter LPM mode. */
+TSI_STATIC bool TSI_UpdateScanRate(TSI_LibHandleTypeDef *handle)
+{
+    uint32_t tick = TSI_GetTick(handle);
+    uint32_t idleTick;
+
+    if(TSI_IsAnyWidgetActive(handle)) {
+        handle->lastActiveTick = tick;
+        TSI_SetTimerPeriod(handle->scanIntvTimer, TSI_SCAN_PERIOD_TICK);
+        return false;
+    }
+
+    idleTick = tick - handle->lastActiveTick;
+    if(idleTick >= TSI_SCAN_IDLE_TIMEOUT_TICK) {
+        TSI_SetTimerPeriod(handle->scanIntvTimer, TSI_SCAN_IDLE_PERIOD_TICK);
+    }
+#if (TSI_USED_IN_LPM_MODE == 1U)
+    if((TSI_SCAN_LPM_TIMEOUT_TICK != 0U) && (idleTick >= TSI_SCAN_LPM_TIMEOUT_TICK)) {
+        return true;
+    }
+#endif  /* TSI_USED_IN_LPM_MODE == 1U */
+
+    return false;
+}
+#endif  /* TSI_ADAPTIVE_SCAN_RATE == 1U */
@@ -50,6 +50,10 @@ void TSI_LPMBlockHandler(TSI_LibHandleTypeDef *handle);
 void TSI_WidgetUpdateCpltCallback(TSI_LibHandleTypeDef *handle);
 void TSI_ScanOverrunCallback(TSI_LibHandleTypeDef *handle);
 void TSI_ScanErrorCallback(TSI_LibHandleTypeDef *handle);
+void *TSI_ScratchAcquireCallback(TSI_LibHandleTypeDef *handle, uint32_t size);
+void TSI_ScratchReleaseCallback(TSI_LibHandleTypeDef *handle);
+uint8_t TSI_UserCommandCallback(TSI_LibHandleTypeDef *handle, uint8_t cmdCode,
+                                uint16_t param0, uint8_t param1, uint8_t *result);
 
 #ifdef __cplusplus
 }
@@ -217,6 +217,11 @@ typedef enum _TSI_LibStat {
 #define TSI_CMD_CALC_SENSOR_CAP             (0x32U)
 #define TSI_CMD_CALC_ALL_SENSOR_CAP         (0x33U)
 
+/**
+ *  Application commands (0x38-0x3F), handled by TSI_UserCommandCallback().
+ */
+#define TSI_CMD_USER_BASE                   (0x38U)
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,10 +2,17 @@
 #include "tsi_object.h"
 #include <string.h>
 
+#if ((TSI_SCAN_GROUP_SCHEDULE == 1U) && (TSI_SCAN_GROUP_NUM > 32U))
+#error "TSI_SCAN_GROUP_SCHEDULE = 1 supports up to 32 scan groups."
+#endif
+
 /* Private function prototypes ----------------------------------------------*/
 TSI_STATIC void TSI_ScanGroupFirst(TSI_DriverTypeDef *drv);
 TSI_STATIC bool TSI_ScanGroupNext(TSI_DriverTypeDef *drv);
 TSI_STATIC TSI_RetCode TSI_ClockSetupForCurrFreq(TSI_DriverTypeDef *drv);
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+TSI_STATIC void TSI_ScanGroupSchedule(TSI_DriverTypeDef *drv);
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
 
 /* API implementations ------------------------------------------------------*/
 TSI_RetCode TSI_Drv_Init(TSI_DriverTypeDef *drv)
@@ -22,6 +29,13 @@ TSI_RetCode TSI_Drv_Init(TSI_DriverTypeDef *drv)
     drv->scanGroupIdx = TSI_SCAN_GROUP_NUM;
     drv->oldScanGroupIdx = TSI_SCAN_GROUP_NUM;
     drv->freqIdx = 0U;
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    drv->fullRate = 0U;
+    drv->frameCnt = 0U;
+    drv->dueMask = 0xFFFFFFFFUL;
+    drv->frameMask = 0UL;
+    drv->cpltMask = 0xFFFFFFFFUL;
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
 
     /* Device init */
     ret = TSI_Dev_Init(drv);
@@ -116,6 +130,54 @@ TSI_RetCode TSI_Drv_DisableWidget(TSI_DriverTypeDef *drv, struct _TSI_Widget *wi
     return TSI_PASS;
 }
 
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+uint8_t TSI_Drv_IsWidgetScanned(TSI_DriverTypeDef *drv, struct _TSI_Widget *widget)
+{
+    const TSI_ScanGroupTypeDef *group;
+    uint32_t i;
+
+    if(drv->cpltMask == 0xFFFFFFFFUL) {
+        return 1U;
+    }
+
+    /* Widget's own scan group, or the one of its sensors (non-parallel self-cap). */
+    group = widget->meta->dedicatedScanGroup;
+    if(group == NULL) {
+        group = widget->meta->sensors[0].meta->dedicatedScanGroup;
+    }
+    if((group != NULL) && (group >= drv->scanGroups) &&
+            (group < &drv->scanGroups[drv->scanGroupNum])) {
+        i = (uint32_t)(group - drv->scanGroups);
+        return ((drv->cpltMask & (1UL << i)) != 0U) ? 1U : 0U;
+    }
+
+    /* Otherwise look for a sensor of the widget in the scanned groups. */
+    for(i = 0U; i < drv->scanGroupNum; i++) {
+        if((drv->cpltMask & (1UL << i)) == 0U) {
+            continue;
+        }
+        group = &drv->scanGroups[i];
+        TSI_FOREACH_OBJ(uint16_t *, snsId, group->sensors, group->size) {
+            if(TSI_SensorPointers[*snsId]->meta->parent == widget) {
+                return 1U;
+            }
+        }
+        TSI_FOREACH_END()
+    }
+    return 0U;
+}
+
+void TSI_Drv_SetFullRate(TSI_DriverTypeDef *drv, uint8_t fullRate)
+{
+    drv->fullRate = fullRate;
+    if(fullRate != 0U) {
+        /* A continuous scan may already have scheduled the next frame with the
+           old rate. Groups not reached yet in that frame become due. */
+        drv->dueMask = 0xFFFFFFFFUL;
+    }
+}
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+
 TSI_RetCode TSI_Drv_StartScan(TSI_DriverTypeDef *drv, TSI_DrvScanMode mode,
                               uint8_t oneShot)
 {
@@ -302,6 +364,10 @@ void TSI_Drv_HandleEndOfScan(TSI_DriverTypeDef *drv)
         /* Reset scan freq index */
         drv->freqIdx = 0U;
 #endif
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+        /* All frequencies of current group done */
+        drv->frameMask |= (1UL << drv->scanGroupIdx);
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
         hasNext = TSI_ScanGroupNext(drv);
         if(TSI_DRV_GET_STAT(drv, TSI_DRV_STAT_SCAN_EMPTY) != 0U) {
             /* Nothing to scan, suspend.
@@ -318,6 +384,11 @@ void TSI_Drv_HandleEndOfScan(TSI_DriverTypeDef *drv)
                 /* If previous value is not acquired by user, set the scan overrun flag. */
                 TSI_DRV_SET_STAT(drv, TSI_DRV_STAT_SCAN_OVERRUN);
             }
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+            /* Groups of the completed frame, read by widget processing */
+            drv->cpltMask = drv->frameMask;
+            drv->frameMask = 0UL;
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
             TSI_DRV_SET_STAT(drv, TSI_DRV_STAT_SCAN_CPLT);
             if(drv->single) {
                 /* Single scan: stop running. */
@@ -384,7 +455,23 @@ TSI_STATIC void TSI_ScanGroupFirst(TSI_DriverTypeDef *drv)
     TSI_INFO("TSI_ScanGroupFirst - Set old scan group: %d, current scan group: %d",
              drv->oldScanGroupIdx,
              drv->scanGroupIdx);
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    /* New frame begins, groups of an aborted frame are dropped */
+    drv->frameMask = 0UL;
+    TSI_ScanGroupSchedule(drv);
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
     (void)TSI_ScanGroupNext(drv);
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    if((TSI_DRV_GET_STAT(drv, TSI_DRV_STAT_SCAN_EMPTY) != 0U) &&
+            (drv->dueMask != 0xFFFFFFFFUL)) {
+        /* No enabled group is due in this frame. Scan all enabled groups
+           rather than suspending the driver. */
+        TSI_DRV_CLR_STAT(drv, TSI_DRV_STAT_SCAN_EMPTY);
+        drv->dueMask = 0xFFFFFFFFUL;
+        drv->scanGroupIdx = drv->scanGroupNum;
+        (void)TSI_ScanGroupNext(drv);
+    }
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
     drv->oldScanGroupIdx = oldIdx;
 }
 
@@ -402,6 +489,12 @@ TSI_STATIC bool TSI_ScanGroupNext(TSI_DriverTypeDef *drv)
     else if(currIdx >= drv->scanGroupNum) {
         isGroupEnd = true;
         currIdx = 0U;
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+        if(drv->single == 0U) {
+            /* Continuous scan: new frame begins */
+            TSI_ScanGroupSchedule(drv);
+        }
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
     }
 
     TSI_INFO("TSI_ScanGroupNext - Old scan group %d is %s",
@@ -445,6 +538,12 @@ TSI_STATIC bool TSI_ScanGroupNext(TSI_DriverTypeDef *drv)
             /* Cannot be here */
             TSI_ASSERT(0U);
         }
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+        if((drv->dueMask & (1UL << currIdx)) == 0U) {
+            /* Not due in current frame */
+            isEnabled = false;
+        }
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
         TSI_INFO("TSI_ScanGroupNext - Group %d: %s",
                  currIdx, isEnabled ? "Yes" : "No");
         if(isEnabled) { break; }
@@ -458,6 +557,12 @@ TSI_STATIC bool TSI_ScanGroupNext(TSI_DriverTypeDef *drv)
         else if(currIdx >= drv->scanGroupNum) {
             isGroupEnd = true;
             currIdx = 0U;
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+            if(drv->single == 0U) {
+                /* Continuous scan: new frame begins */
+                TSI_ScanGroupSchedule(drv);
+            }
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
         }
     }
 
@@ -499,3 +604,29 @@ TSI_STATIC TSI_RetCode TSI_ClockSetupForCurrFreq(TSI_DriverTypeDef *drv)
 
     return res;
 }
+
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+TSI_STATIC void TSI_ScanGroupSchedule(TSI_DriverTypeDef *drv)
+{
+    uint32_t mask = 0xFFFFFFFFUL;
+    uint8_t i;
+
+    /* Temporary single group lists (calibration, init scan, LPM wake scan)
+       are always due. */
+    if((drv->scanPeriods != NULL) && (drv->fullRate == 0U) &&
+            (drv->scanGroupNum > 1U)) {
+        mask = 0U;
+        for(i = 0U; i < drv->scanGroupNum; i++) {
+            uint8_t period = drv->scanPeriods[i];
+            if((period <= 1U) || ((drv->frameCnt % period) == 0U)) {
+                mask |= (1UL << i);
+            }
+        }
+    }
+
+    TSI_INFO("TSI_ScanGroupSchedule - Frame %d, due mask 0x%x",
+             drv->frameCnt, mask);
+    drv->frameCnt++;
+    drv->dueMask = mask;
+}
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
@@ -116,6 +116,15 @@ struct _TSI_Driver {
     /** Sensor list size. */
     uint8_t sensorNum;
 
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    /**
+     * Scan group period list (Unit: frame). Group N is scanned once every
+     * scanPeriods[N] frames, 0 and 1 both mean every frame. Set to NULL to
+     * scan all groups every frame.
+     */
+    const uint8_t *scanPeriods;
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+
     /* Operation state --------------*/
     /** Scan mode. */
     TSI_DrvScanMode scanMode;
@@ -131,6 +140,15 @@ struct _TSI_Driver {
      */
     uint8_t forceReConf;
 
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    /**
+     * Full rate flag (1: true, 0: false). Scan all enabled groups every frame
+     * regardless of :c:member:`scanPeriods`. Set by library while any widget
+     * is active.
+     */
+    uint8_t fullRate;
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+
     /* Internals --------------------*/
     /** Current scan group index. */
     uint8_t scanGroupIdx;
@@ -141,6 +159,23 @@ struct _TSI_Driver {
     /** Current scan freq index. */
     uint8_t freqIdx;
 
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    /** Frame counter for scan group scheduling. */
+    uint16_t frameCnt;
+
+    /** Scan groups due in current frame. Bit N for group N. */
+    uint32_t dueMask;
+
+    /** Scan groups scanned so far in current frame. Bit N for group N. */
+    uint32_t frameMask;
+
+    /**
+     * Scan groups scanned in the last completed frame. Bit N for group N.
+     * Widgets of the other groups are not processed for that frame.
+     */
+    uint32_t cpltMask;
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+
     /**
      * Internal Status flags.
      *
@@ -181,6 +216,10 @@ TSI_RetCode TSI_Drv_StopScan(TSI_DriverTypeDef *drv);
 /* Widget control APIs */
 TSI_RetCode TSI_Drv_EnableWidget(TSI_DriverTypeDef *drv, struct _TSI_Widget *widget);
 TSI_RetCode TSI_Drv_DisableWidget(TSI_DriverTypeDef *drv, struct _TSI_Widget *widget);
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+uint8_t TSI_Drv_IsWidgetScanned(TSI_DriverTypeDef *drv, struct _TSI_Widget *widget);
+void TSI_Drv_SetFullRate(TSI_DriverTypeDef *drv, uint8_t fullRate);
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
 
 /* TSI driver event handlers */
 void TSI_Drv_HandleSensorData(TSI_DriverTypeDef *drv, struct _TSI_Sensor *sensor, uint32_t data);
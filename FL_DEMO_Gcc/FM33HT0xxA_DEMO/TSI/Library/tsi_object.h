@@ -390,6 +390,17 @@ struct _TSI_LibCallbacks {
     void (*processInitScanValue)(TSI_LibHandleTypeDef *handle,
                                  struct _TSI_Widget *widget, struct _TSI_Sensor *sensor,
                                  uint16_t *pValueBuffer);
+
+    /**
+     * Used during library sensor initialization. If getInitScanBufferAndCount()
+     * returns a valid scan count but leaves buffer pointer NULL, library will
+     * pass each scan result(TSI_TOTAL_SCAN_NUM values) to user using this
+     * callback instead of filling a buffer. User can keep running statistics
+     * and set final value in processInitScanValue().
+     */
+    void (*processInitScanSample)(TSI_LibHandleTypeDef *handle,
+                                  struct _TSI_Widget *widget, struct _TSI_Sensor *sensor,
+                                  uint32_t sampleIdx, const uint16_t *pSample);
 };
 
 /** TSI Library handle struct. */
@@ -451,6 +462,11 @@ struct _TSI_LibHandle {
     /** Scan interval flag. */
     uint8_t scanIntvFlag;
 
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+    /** Tick of last widget activity. */
+    uint32_t lastActiveTick;
+#endif  /* TSI_ADAPTIVE_SCAN_RATE == 1U */
+
 #endif  /* TSI_SCAN_USE_TIMEBASE == 1U */
 #endif  /* TSI_USE_TIMEBASE == 1U */
 
@@ -458,6 +474,23 @@ struct _TSI_LibHandle {
     /** Set this flag if library is in LPM mode. */
     uint8_t isLPM;
 
+#if (TSI_LPM_WAKE_ON_TOUCH == 1U)
+    /** LPM wake-on-touch statistics. */
+    struct {
+        /** Wake scan(wake scan group only) count. */
+        uint32_t wakeScanCnt;
+
+        /** Count of wake scans which crossed wake threshold. */
+        uint32_t wakeCnt;
+
+        /** Full scan and processing count. */
+        uint32_t fullScanCnt;
+
+        /** Wake scan count since last full scan. */
+        uint16_t idleScanCnt;
+    } lpmStat;
+
+#endif  /* TSI_LPM_WAKE_ON_TOUCH == 1U */
 #endif  /* TSI_USE_LPM_MODE == 1U */
 };
 
@@ -122,4 +122,5 @@ void TSI_Plugin_Init(TSI_LibHandleTypeDef *handle)
     /* Setup callback */
     TSI_PLUGIN_SET_CB_DIRECT(handle->cb, getInitScanBufferAndCount);
     TSI_PLUGIN_SET_CB_DIRECT(handle->cb, processInitScanValue);
+    TSI_PLUGIN_SET_CB_DIRECT(handle->cb, processInitScanSample);
 }
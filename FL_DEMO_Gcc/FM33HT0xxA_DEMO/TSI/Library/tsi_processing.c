@@ -32,6 +32,7 @@ static uint8_t TSI_Peak1DNum;
 TSI_STATIC void TSI_Widget_ProcessDiffAndBaseline(TSI_LibHandleTypeDef *handle, TSI_WidgetTypeDef *widget);
 TSI_STATIC void TSI_Widget_ProcessStatusAndBaseline(TSI_LibHandleTypeDef *handle, TSI_WidgetTypeDef *widget);
 TSI_STATIC void TSI_Widget_ProcessPrivateData(TSI_LibHandleTypeDef *handle, TSI_WidgetTypeDef *widget);
+TSI_STATIC bool TSI_Widget_IsDue(TSI_LibHandleTypeDef *handle, TSI_WidgetTypeDef *widget);
 TSI_STATIC void TSI_Widget_InitSelfCapButton(TSI_SelfCapButtonTypeDef *button);
 TSI_STATIC void TSI_Widget_InitSelfCapProximity(TSI_SelfCapProximityTypeDef *proximity);
 TSI_STATIC void TSI_Widget_InitSelfCapSlider(TSI_SelfCapSliderTypeDef *slider);
@@ -205,7 +206,7 @@ void TSI_Widget_UpdateAll(TSI_LibHandleTypeDef *handle)
 
     TSI_FOREACH_OBJ(TSI_WidgetTypeDef **, ppWidget, handle->widgets,
                     handle->widgetNum) {
-        if((*ppWidget)->enable == TSI_WIDGET_ENABLE) {
+        if(TSI_Widget_IsDue(handle, *ppWidget)) {
             /* Update diffcount and baseline */
             TSI_Widget_ProcessDiffAndBaseline(handle, *ppWidget);
         }
@@ -219,7 +220,7 @@ void TSI_Widget_UpdateAll(TSI_LibHandleTypeDef *handle)
 
     TSI_FOREACH_OBJ(TSI_WidgetTypeDef **, ppWidget, handle->widgets,
                     handle->widgetNum) {
-        if((*ppWidget)->enable == TSI_WIDGET_ENABLE) {
+        if(TSI_Widget_IsDue(handle, *ppWidget)) {
             /* Update sensor status and baseline mode */
             TSI_Widget_ProcessStatusAndBaseline(handle, *ppWidget);
             /* Update widget-specified data */
@@ -280,6 +281,22 @@ void TSI_Baseline_Update(TSI_SensorTypeDef *sensor, TSI_DetectConfTypeDef *detCo
 }
 
 /* Private function implemenations ------------------------------------------*/
+/* Enabled widget whose scan group was scanned in the completed frame. A group
+   skipped by scan group scheduling keeps its previous raw count, which shall
+   not be filtered and debounced again. */
+TSI_STATIC bool TSI_Widget_IsDue(TSI_LibHandleTypeDef *handle, TSI_WidgetTypeDef *widget)
+{
+    if(widget->enable != TSI_WIDGET_ENABLE) {
+        return false;
+    }
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    return (TSI_Drv_IsWidgetScanned(handle->driver, widget) != 0U);
+#else
+    TSI_UNUSED(handle)
+    return true;
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+}
+
 TSI_STATIC void TSI_Widget_ProcessDiffAndBaseline(TSI_LibHandleTypeDef *handle, TSI_WidgetTypeDef *widget)
 {
     TSI_DetectConfTypeDef *widgetDetConf = &widget->detConf;
@@ -1,6 +1,14 @@
 #include "tsi_utils.h"
 #include "tsi_driver.h"
 
+/* Private macros -----------------------------------------------------------*/
+/** Check if deadline is reached at tick(wrap-around safe). */
+#define TSI_TIMER_EXPIRED(TICK, DEADLINE)   ((int32_t)((TICK) - (DEADLINE)) >= 0)
+
+/* Private function prototypes ----------------------------------------------*/
+static void TSI_InsertTimer(TSI_TimerTypeDef *timer);
+static void TSI_RemoveTimer(TSI_TimerTypeDef *timer);
+
 uint32_t TSI_CalcSelfCapSensorCap(TSI_ClockConfTypeDef *clockConf, TSI_SensorTypeDef *sensor, uint8_t update)
 {
     TSI_SelfCapWidgetTypeDef *scWidget;
@@ -69,12 +77,15 @@ void TSI_InitTimer(TSI_TimerContextTypeDef *context, TSI_TimerTypeDef *timer,
     TSI_ASSERT(context != NULL);
     TSI_ASSERT(timer != NULL);
     TSI_ASSERT(cb != NULL);
+    TSI_ASSERT(period != 0U);
 
-    timer->period = period;
+    /* A reloaded timer with period 0 would expire again at once. */
+    timer->period = (period != 0U) ? period : 1U;
     timer->context = context;
-    timer->begin = 0U;
+    timer->deadline = 0U;
     timer->callback = cb;
     timer->next = NULL;
+    timer->prev = NULL;
 }
 
 void TSI_StartTimer(TSI_TimerTypeDef *timer)
@@ -85,12 +96,9 @@ void TSI_StartTimer(TSI_TimerTypeDef *timer)
         /* Timer already started. */
         return;
     }
-    /* Setup begin time. */
-    timer->begin = timer->context->timeBaseTick;
-
-    /* Add timer to the list. */
-    timer->next = timer->context->head;
-    timer->context->head = timer;
+    /* Setup deadline and add timer to the list. */
+    timer->deadline = timer->context->timeBaseTick + timer->period;
+    TSI_InsertTimer(timer);
     timer->used = 1U;
 }
 
@@ -105,13 +113,13 @@ void TSI_RestartTimer(TSI_TimerTypeDef *timer)
     }
 
     /* Reset timeout */
-    timer->begin = timer->context->timeBaseTick;
+    TSI_RemoveTimer(timer);
+    timer->deadline = timer->context->timeBaseTick + timer->period;
+    TSI_InsertTimer(timer);
 }
 
 void TSI_StopTimer(TSI_TimerTypeDef *timer)
 {
-    TSI_TimerTypeDef **currTimer;
-
     TSI_ASSERT(timer != NULL);
 
     if(timer->used == 0U) {
@@ -119,14 +127,25 @@ void TSI_StopTimer(TSI_TimerTypeDef *timer)
         return;
     }
     /* Remove timer from the list. */
-    for(currTimer = &timer->context->head; *currTimer != NULL;) {
-        TSI_TimerTypeDef *entry = *currTimer;
-        if(entry == timer) {
-            *currTimer = entry->next;
-            timer->used = 0U;
-            break;
-        }
-        currTimer = &entry->next;
+    TSI_RemoveTimer(timer);
+    timer->used = 0U;
+}
+
+void TSI_SetTimerPeriod(TSI_TimerTypeDef *timer, uint32_t period)
+{
+    TSI_ASSERT(timer != NULL);
+    TSI_ASSERT(period != 0U);
+
+    if(period == 0U) {
+        period = 1U;
+    }
+    if(timer->period == period) {
+        return;
+    }
+    timer->period = period;
+    if(timer->used != 0U) {
+        /* Apply new period from now on */
+        TSI_RestartTimer(timer);
     }
 }
 
@@ -141,13 +160,15 @@ void TSI_TimerHandler(TSI_TimerContextTypeDef *context)
         /* Tick has not advanced. */
         return;
     }
-    for(timer = context->head; timer != NULL; timer = timer->next) {
-        if(tick - timer->begin >= timer->period) {
-            /* Timer timeout, reload */
-            timer->begin = tick;
-            /* Notify using callback */
-            timer->callback(context->context);
-        }
+    /* List is sorted by deadline: stop at the first timer not expired. */
+    while((timer = context->head) != NULL &&
+            TSI_TIMER_EXPIRED(tick, timer->deadline)) {
+        /* Timer timeout, reload */
+        TSI_RemoveTimer(timer);
+        timer->deadline = tick + timer->period;
+        TSI_InsertTimer(timer);
+        /* Notify using callback */
+        timer->callback(context->context);
     }
 }
 
@@ -160,3 +181,44 @@ uint32_t TSI_GetTimerTick(TSI_TimerContextTypeDef *context)
 {
     return context->timeBaseTick;
 }
+
+/* Private function implemenations ------------------------------------------*/
+static void TSI_InsertTimer(TSI_TimerTypeDef *timer)
+{
+    TSI_TimerContextTypeDef *context = timer->context;
+    TSI_TimerTypeDef *prev = NULL;
+    TSI_TimerTypeDef *curr = context->head;
+
+    /* Find position. Timers with same deadline keep their start order. */
+    while(curr != NULL && TSI_TIMER_EXPIRED(timer->deadline, curr->deadline)) {
+        prev = curr;
+        curr = curr->next;
+    }
+
+    timer->prev = prev;
+    timer->next = curr;
+    if(curr != NULL) {
+        curr->prev = timer;
+    }
+    if(prev != NULL) {
+        prev->next = timer;
+    }
+    else {
+        context->head = timer;
+    }
+}
+
+static void TSI_RemoveTimer(TSI_TimerTypeDef *timer)
+{
+    if(timer->prev != NULL) {
+        timer->prev->next = timer->next;
+    }
+    else {
+        timer->context->head = timer->next;
+    }
+    if(timer->next != NULL) {
+        timer->next->prev = timer->prev;
+    }
+    timer->next = NULL;
+    timer->prev = NULL;
+}
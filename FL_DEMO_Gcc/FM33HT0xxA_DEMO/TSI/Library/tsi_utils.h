@@ -14,13 +14,13 @@ typedef void (*TSI_TimerCallBackFuncTypeDef)(void *context);
 
 /** Software timer struct definition. */
 struct _TSI_Timer {
-    /** Timeout begin tick. */
-    uint32_t begin;
+    /** Timeout deadline tick. */
+    uint32_t deadline;
 
     /** Set to 1 if timer is used, which means it has been started. */
     uint32_t used : 1U;
 
-    /** Tick period. */
+    /** Tick period, at least 1. */
     uint32_t period : 31U;
 
     /** Timeout callback. */
@@ -31,6 +31,9 @@ struct _TSI_Timer {
 
     /** Pointer to next item. */
     TSI_TimerTypeDef *next;
+
+    /** Pointer to previous item. */
+    TSI_TimerTypeDef *prev;
 };
 
 
@@ -42,7 +45,10 @@ struct _TSI_TimerContext {
     /** Timebase tick counter. */
     volatile uint32_t timeBaseTick;
 
-    /** Timer list head. */
+    /**
+     * Timer list head. Started timers are sorted by deadline, so only the
+     * head needs to be checked for expiry.
+     */
     TSI_TimerTypeDef *head;
 };
 
@@ -57,6 +63,7 @@ void TSI_InitTimer(TSI_TimerContextTypeDef *context, TSI_TimerTypeDef *timer,
 void TSI_StartTimer(TSI_TimerTypeDef *timer);
 void TSI_RestartTimer(TSI_TimerTypeDef *timer);
 void TSI_StopTimer(TSI_TimerTypeDef *timer);
+void TSI_SetTimerPeriod(TSI_TimerTypeDef *timer, uint32_t period);
 void TSI_TimerHandler(TSI_TimerContextTypeDef *context);
 void TSI_IncTimerTick(TSI_TimerContextTypeDef *context, uint32_t tick);
 uint32_t TSI_GetTimerTick(TSI_TimerContextTypeDef *context);
@@ -36,23 +36,52 @@ extern "C" {
 /** Use configruation descriptor. */
 #define TSI_USE_CONFIG_DESCRIPTOR               (1U)
 
-/** Use timebase. */
-#define TSI_USE_TIMEBASE                        (0U)
+/** Use timebase. Ticks are supplied by TSI_IncTick() from LPTIM16 interrupt. */
+#define TSI_USE_TIMEBASE                        (1U)
 
 /** Timebase tick time (Unit: us). */
 #define TSI_TIMEBASE_US                         (1000U)
 
 #if (TSI_USE_TIMEBASE == 1U)
 /** Enables accurate scan interval controlling. */
-#define TSI_SCAN_USE_TIMEBASE                   (0U)
+#define TSI_SCAN_USE_TIMEBASE                   (1U)
 
 /** Scan period (Unit: tick). */
 #define TSI_SCAN_PERIOD_TICK                    (20U)
+
+#if (TSI_SCAN_USE_TIMEBASE == 1U)
+/**
+ * Adaptive scan rate. Scan with TSI_SCAN_PERIOD_TICK while any widget is
+ * active(or proximity sensor has diffcount), and with
+ * TSI_SCAN_IDLE_PERIOD_TICK after TSI_SCAN_IDLE_TIMEOUT_TICK of idle.
+ */
+#define TSI_ADAPTIVE_SCAN_RATE                  (1U)
+
+/** Idle scan period (Unit: tick). */
+#define TSI_SCAN_IDLE_PERIOD_TICK               (100U)
+
+/** Idle time before switching to idle scan period (Unit: tick). */
+#define TSI_SCAN_IDLE_TIMEOUT_TICK              (2000U)
+
+/**
+ * Idle time before entering LPM mode automatically (Unit: tick). Requires
+ * TSI_USED_IN_LPM_MODE. 0 to disable.
+ */
+#define TSI_SCAN_LPM_TIMEOUT_TICK               (10000U)
+#endif  /* TSI_SCAN_USE_TIMEBASE == 1U */
 #endif  /* TSI_USE_TIMEBASE == 1U */
 
 /* Driver maximum scan group sensor num */
 #define TSI_MAX_SCANGROUP_SENSOR_NUM            (6U)
 
+/**
+ * Scan group scheduling. Each scan group is scanned once every N frames as
+ * configured in the scan group period list, so slow groups (buttons) cost
+ * less while fast groups (proximity) keep their rate. All enabled groups
+ * are scanned every frame while any widget is active.
+ */
+#define TSI_SCAN_GROUP_SCHEDULE                 (1U)
+
 /**
  * Number of multi-frequency scan's freqency.
  *
@@ -192,6 +221,27 @@ extern "C" {
 /** Number of scan in LPM mode. Library will use the last scan result. */
 #define TSI_LPM_SCAN_NUM                        (1U)
 
+/**
+ * Wake on touch. In LPM mode only the wake scan group(a self-cap parallel
+ * scan group) is scanned. Full scan and processing run only when the ganged
+ * sensor crosses the wake threshold.
+ */
+#define TSI_LPM_WAKE_ON_TOUCH                   (1U)
+
+#if (TSI_LPM_WAKE_ON_TOUCH == 1U)
+/** Wake scan group index. Must be a self-cap parallel scan group. */
+#define TSI_LPM_WAKE_SCAN_GROUP                 (4U)
+
+/** Wake threshold (Unit: count above baseline). 0 for widget noise threshold. */
+#define TSI_LPM_WAKE_TH                         (0U)
+
+/**
+ * Run full scan and processing every N wake scans even if not touched,
+ * which keeps baselines tracking. 0 to disable.
+ */
+#define TSI_LPM_WAKE_REFRESH_NUM                (50U)
+#endif  /* TSI_LPM_WAKE_ON_TOUCH == 1U */
+
 #endif  /* TSI_USED_IN_LPM_MODE == 1U */
 
 /* Misc configurations ------------------------------------------------------*/
@@ -176,6 +176,14 @@ TSI_SCAN_GROUP(4, TSI_SCAN_GROUP_SELF_CAP_PARALLEL, 6,TSI_DEV_OPT_IDLE_FLOATING)
 {
     9,6,1,0,4,3
 };
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+/* Scan group periods (Unit: frame). Proximity every frame, buttons every 4th
+   frame until any widget becomes active. */
+static const uint8_t TSI_ScanGroupPeriods[TSI_SCAN_GROUP_NUM] = {
+    4U, 4U, 4U, 4U, 1U
+};
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
+
 /*-----------------------------------*/
 /* Library and driver init data      */
 /*-----------------------------------*/
@@ -198,10 +206,16 @@ TSI_SECTION(TSI_LIB_SECTION) = {
 #if (TSI_SCAN_USE_TIMEBASE == 1U)
     &TSI_ScanInvTimer,
     0U,
+#if (TSI_ADAPTIVE_SCAN_RATE == 1U)
+    0UL,
+#endif
 #endif
 #endif
 #if (TSI_USED_IN_LPM_MODE == 1U)
     0U,
+#if (TSI_LPM_WAKE_ON_TOUCH == 1U)
+    { 0U },
+#endif
 #endif
 };
 
@@ -222,6 +236,9 @@ TSI_SECTION(TSI_CONST_DRVIER_SECTION) = {
     TSI_SCAN_GROUP_NUM,
     (TSI_SensorTypeDef **) &TSI_SensorPointers[0],
     TSI_SENSOR_NUM,
+#if (TSI_SCAN_GROUP_SCHEDULE == 1U)
+    &TSI_ScanGroupPeriods[0],
+#endif  /* TSI_SCAN_GROUP_SCHEDULE == 1U */
 };
 
 /*-----------------------------------*/
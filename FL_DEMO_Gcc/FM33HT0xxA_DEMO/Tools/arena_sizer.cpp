@@ -0,0 +1,291 @@
+/* ===========================================  Includes  =========================================== */
+/*
+ * Host tool: measure exact tensor arena usage of a model and emit a header for
+ * firmware builds. Build and run with `make arena_size`.
+ *
+ * Usage: arena_sizer <output header> [model.tflite ...]
+ * Without a .tflite file the model array linked in (MODEL_ARRAY) is used,
+ * MODEL_COUNT times. Several models are sized as the firmware model registry
+ * builds them: one allocator, persistent data stacked, activations shared.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/recording_micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#ifdef FC_INT8_M0
+#include "fc_int8_m0.h"
+#endif
+
+#ifdef FC_PAL4_M0
+#include "fc_pal4_m0.h"
+#endif
+
+#ifdef LUT_INT8_M0
+#include "lut_int8_m0.h"
+#endif
+
+/* ============================================  Define  ============================================ */
+#ifndef MODEL_ARRAY
+#define MODEL_ARRAY g_hello_world_int8_model_data
+#endif
+
+#ifndef MODEL_COUNT
+#define MODEL_COUNT 1
+#endif
+
+/* Models one arena may hold */
+#define MODEL_MAX   8
+
+#define STR_(x) #x
+#define STR(x)  STR_(x)
+
+/* ==========================================  Variables  =========================================== */
+extern const unsigned char MODEL_ARRAY[];
+
+namespace {
+
+constexpr size_t kMaxArenaSize = 256 * 1024;
+alignas(16) uint8_t arena[kMaxArenaSize];
+
+#ifdef LUT_INT8_M0
+/*Logistic/Tanh resolved to the LUT kernels as in firmware*/
+using ToolOpResolver = tflite::LutActivationOpResolver<16>;
+#else
+using ToolOpResolver = tflite::MicroMutableOpResolver<16>;
+#endif
+
+/*Register every op the firmware may use, unused registrations cost no arena*/
+TfLiteStatus RegisterOps(ToolOpResolver &resolver)
+{
+#if defined(FC_PAL4_M0)
+  /*Palettized filters also take FC_PAL4_TILE_BYTES of scratch per op*/
+  TF_LITE_ENSURE_STATUS(resolver.AddFullyConnected(tflite::Register_FULLY_CONNECTED_PAL4_M0()));
+#elif defined(FC_INT8_M0)
+  /*Same kernel as firmware, it keeps folded bias in persistent arena*/
+  TF_LITE_ENSURE_STATUS(resolver.AddFullyConnected(tflite::Register_FULLY_CONNECTED_INT8_M0()));
+#else
+  TF_LITE_ENSURE_STATUS(resolver.AddFullyConnected());
+#endif
+  TF_LITE_ENSURE_STATUS(resolver.AddRelu());
+  TF_LITE_ENSURE_STATUS(resolver.AddLogistic());
+  TF_LITE_ENSURE_STATUS(resolver.AddTanh());
+  TF_LITE_ENSURE_STATUS(resolver.AddSoftmax());
+  TF_LITE_ENSURE_STATUS(resolver.AddReshape());
+  TF_LITE_ENSURE_STATUS(resolver.AddQuantize());
+  TF_LITE_ENSURE_STATUS(resolver.AddDequantize());
+  TF_LITE_ENSURE_STATUS(resolver.AddConv2D());
+  TF_LITE_ENSURE_STATUS(resolver.AddDepthwiseConv2D());
+  TF_LITE_ENSURE_STATUS(resolver.AddAveragePool2D());
+  TF_LITE_ENSURE_STATUS(resolver.AddMaxPool2D());
+  TF_LITE_ENSURE_STATUS(resolver.AddAdd());
+  TF_LITE_ENSURE_STATUS(resolver.AddMul());
+  TF_LITE_ENSURE_STATUS(resolver.AddMean());
+  return kTfLiteOk;
+}
+
+const char *kAllocationTypeNames[] = {
+  "Eval tensor data",
+  "Persistent tensor data",
+  "Persistent quantization data",
+  "Persistent buffer data",
+  "Variable tensor data",
+  "Node and registration array",
+  "Op data",
+};
+
+/* ====================================  Functions define  ===================================== */
+unsigned char *LoadFile(const char *path)
+{
+  FILE *fp = fopen(path, "rb");
+  if (fp == nullptr) {
+    return nullptr;
+  }
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+
+  /* Flatbuffer needs aligned storage, same as the flash section */
+  unsigned char *buf = static_cast<unsigned char *>(aligned_alloc(16, (size + 15) & ~15L));
+  if (buf != nullptr && fread(buf, 1, size, fp) != static_cast<size_t>(size)) {
+    free(buf);
+    buf = nullptr;
+  }
+  fclose(fp);
+  return buf;
+}
+
+/*Arena size accepted by a plain MicroInterpreter, as used on target*/
+bool FitsArena(const tflite::Model *model, const ToolOpResolver &resolver, size_t size)
+{
+  tflite::MicroInterpreter interpreter(model, resolver, arena, size);
+  return interpreter.AllocateTensors() == kTfLiteOk;
+}
+
+/*Arena size accepted by all models on one allocator, as the firmware registry*/
+bool FitsSharedArena(const tflite::Model *const *models, int num, const ToolOpResolver &resolver,
+                     size_t size)
+{
+  alignas(tflite::MicroInterpreter) static uint8_t buffers[MODEL_MAX][sizeof(tflite::MicroInterpreter)];
+  tflite::MicroInterpreter *interpreters[MODEL_MAX] = {nullptr};
+  bool fits = true;
+
+  tflite::MicroAllocator *allocator = tflite::MicroAllocator::Create(arena, size);
+  if (allocator == nullptr) {
+    return false;
+  }
+  for (int i = 0; fits && i < num; ++i) {
+    interpreters[i] = new (buffers[i]) tflite::MicroInterpreter(models[i], resolver, allocator);
+    fits = interpreters[i]->AllocateTensors() == kTfLiteOk;
+  }
+  for (int i = 0; i < num; ++i) {
+    if (interpreters[i] != nullptr) {
+      interpreters[i]->~MicroInterpreter();
+    }
+  }
+  return fits;
+}
+
+/*Smallest arena in alignment steps up to hi bytes, 0 if none fits*/
+template <typename Fits>
+size_t MinimalArena(size_t hi_bytes, Fits fits)
+{
+  const size_t align = tflite::MicroArenaBufferAlignment();
+  size_t lo = 0;
+  size_t hi = (hi_bytes + align - 1) / align;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (fits(mid * align)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return fits(hi * align) ? hi * align : 0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <output header> [model.tflite ...]\n", argv[0]);
+    return 1;
+  }
+
+  const tflite::Model *models[MODEL_MAX];
+  const char *model_names[MODEL_MAX];
+  int num = (argc > 2) ? argc - 2 : MODEL_COUNT;
+  if (num > MODEL_MAX) {
+    fprintf(stderr, "At most %d models\n", MODEL_MAX);
+    return 1;
+  }
+  for (int i = 0; i < num; ++i) {
+    const unsigned char *model_data = MODEL_ARRAY;
+    model_names[i] = STR(MODEL_ARRAY);
+    if (argc > 2) {
+      model_data = LoadFile(argv[2 + i]);
+      model_names[i] = argv[2 + i];
+      if (model_data == nullptr) {
+        fprintf(stderr, "Cannot read %s\n", argv[2 + i]);
+        return 1;
+      }
+    }
+    models[i] = tflite::GetModel(model_data);
+    if (models[i]->version() != TFLITE_SCHEMA_VERSION) {
+      fprintf(stderr, "Unsupported schema version %u\n", models[i]->version());
+      return 1;
+    }
+  }
+
+  static ToolOpResolver resolver;
+  if (RegisterOps(resolver) != kTfLiteOk) {
+    return 1;
+  }
+
+  const size_t align = tflite::MicroArenaBufferAlignment();
+  size_t independent = 0;
+  for (int m = 0; m < num; ++m) {
+    const tflite::Model *model = models[m];
+
+    /* Per allocation type breakdown, recording overhead lives in arena too */
+    size_t recorded_used;
+    {
+      tflite::RecordingMicroInterpreter interpreter(model, resolver, arena, kMaxArenaSize);
+      if (interpreter.AllocateTensors() != kTfLiteOk) {
+        fprintf(stderr, "AllocateTensors() failed, missing op registration?\n");
+        return 1;
+      }
+
+      const tflite::RecordingMicroAllocator &allocator = interpreter.GetMicroAllocator();
+      const tflite::RecordingSingleArenaBufferAllocator *buffer =
+          allocator.GetSimpleMemoryAllocator();
+
+      printf("Model %d: %s\n", m, model_names[m]);
+      printf("%-30s %10s %10s %6s\n", "Allocation type", "Requested", "Used", "Count");
+      for (size_t i = 0; i < sizeof(kAllocationTypeNames) / sizeof(kAllocationTypeNames[0]); ++i) {
+        tflite::RecordedAllocation rec = allocator.GetRecordedAllocation(
+            static_cast<tflite::RecordedAllocationType>(i));
+        printf("%-30s %10zu %10zu %6zu\n", kAllocationTypeNames[i],
+               rec.requested_bytes, rec.used_bytes, rec.count);
+      }
+      printf("Persistent (tail)             : %zu bytes\n", buffer->GetPersistentUsedBytes());
+      printf("Non-persistent/scratch (head) : %zu bytes\n", buffer->GetNonPersistentUsedBytes());
+      recorded_used = interpreter.arena_used_bytes();
+      printf("Total with recording overhead : %zu bytes\n", recorded_used);
+    }
+
+    /* Smallest arena the plain interpreter accepts, in alignment steps */
+    const size_t model_size = MinimalArena(recorded_used, [&](size_t size) {
+      return FitsArena(model, resolver, size);
+    });
+    if (model_size == 0) {
+      fprintf(stderr, "No arena size up to %zu bytes fits\n", recorded_used);
+      return 1;
+    }
+    printf("Minimal arena size            : %zu bytes (alignment %zu)\n\n", model_size, align);
+    independent += model_size;
+  }
+
+  /* One model: same as its own arena. Several: registry on one allocator */
+  size_t arena_size = independent;
+  if (num > 1) {
+    arena_size = MinimalArena(independent, [&](size_t size) {
+      return FitsSharedArena(models, num, resolver, size);
+    });
+    if (arena_size == 0) {
+      fprintf(stderr, "Models do not share an arena of %zu bytes\n", independent);
+      return 1;
+    }
+    printf("%d independent arenas          : %zu bytes\n", num, independent);
+    printf("Shared arena (registry)       : %zu bytes, %zu bytes saved\n", arena_size,
+           independent - arena_size);
+  }
+
+  FILE *fp = fopen(argv[1], "w");
+  if (fp == nullptr) {
+    fprintf(stderr, "Cannot write %s\n", argv[1]);
+    return 1;
+  }
+  fprintf(fp,
+          "/* Generated by Tools/arena_sizer.cpp, do not edit. */\n"
+          "#ifndef __TFLM_ARENA_SIZE_H__\n"
+          "#define __TFLM_ARENA_SIZE_H__\n"
+          "\n"
+          "/* Model: %s%s */\n"
+          "#define TFLM_ARENA_SIZE         (%zu)\n"
+          "#define TFLM_ARENA_ALIGNMENT    (%zu)\n"
+          "#define TFLM_ARENA_MODEL_NUM    (%d)\n"
+          "\n"
+          "#endif\n",
+          model_names[0], (num > 1) ? " and others, shared arena" : "", arena_size, align, num);
+  fclose(fp);
+  return 0;
+}
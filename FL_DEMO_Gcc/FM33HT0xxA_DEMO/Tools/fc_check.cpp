@@ -0,0 +1,145 @@
+/* ===========================================  Includes  =========================================== */
+/*
+ * Host tool: check the Cortex-M0 int8 FullyConnected kernel against
+ * reference_integer_ops::FullyConnected (bit exactness) on random shapes,
+ * input/output offsets, multipliers, shifts and activation ranges. Accum
+ * depths cover every remainder of the 4-way unroll. Build and run with
+ * `make fc_check`.
+ *
+ * Usage: fc_check [CASES [SEED]]
+ * Exit code is non-zero on any mismatch with the reference kernel.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "fc_int8_m0.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+
+/* ============================================  Define  ============================================ */
+#define FC_CHECK_MAX_BATCHES    (4)
+#define FC_CHECK_MAX_OUTPUT     (24)
+#define FC_CHECK_MAX_ACCUM      (67)
+
+/* ==========================================  Variables  =========================================== */
+namespace {
+
+int8_t input[FC_CHECK_MAX_BATCHES * FC_CHECK_MAX_ACCUM];
+int8_t filter[FC_CHECK_MAX_OUTPUT * FC_CHECK_MAX_ACCUM];
+int32_t bias[FC_CHECK_MAX_OUTPUT];
+int32_t folded_bias[FC_CHECK_MAX_OUTPUT];
+int8_t expect[FC_CHECK_MAX_BATCHES * FC_CHECK_MAX_OUTPUT];
+int8_t actual[FC_CHECK_MAX_BATCHES * FC_CHECK_MAX_OUTPUT];
+
+/* ====================================  Functions define  ===================================== */
+int Uniform(std::mt19937 &rng, int lo, int hi)
+{
+  return std::uniform_int_distribution<int>(lo, hi)(rng);
+}
+
+/*One random case, returns the mismatching output count*/
+int CheckCase(std::mt19937 &rng, int accum_depth, int *outputs)
+{
+  const int batches = Uniform(rng, 1, FC_CHECK_MAX_BATCHES);
+  const int output_depth = Uniform(rng, 1, FC_CHECK_MAX_OUTPUT);
+  const bool has_bias = Uniform(rng, 0, 3) != 0;
+
+  tflite::FullyConnectedParams params = {};
+  params.input_offset = Uniform(rng, -127, 128);
+  params.weights_offset = 0;
+  params.output_offset = Uniform(rng, -128, 127);
+  params.output_multiplier = Uniform(rng, 1 << 30, INT32_MAX);
+  /*Accumulator grows with sqrt(accum_depth): scale it to the int8 range, every
+    8th case saturates*/
+  int accum_bits = 0;
+  while ((1 << accum_bits) < accum_depth) {
+    ++accum_bits;
+  }
+  params.output_shift = (Uniform(rng, 0, 7) == 0) ? Uniform(rng, -6, 1)
+                                                   : Uniform(rng, -11, -7) - accum_bits / 2;
+  switch (Uniform(rng, 0, 2)) {
+    case 0:   /* no activation */
+      params.quantized_activation_min = -128;
+      params.quantized_activation_max = 127;
+      break;
+    case 1:   /* ReLU */
+      params.quantized_activation_min = params.output_offset;
+      params.quantized_activation_max = 127;
+      break;
+    default:  /* ReLU6-like range */
+      params.quantized_activation_min = params.output_offset;
+      params.quantized_activation_max = Uniform(rng, params.output_offset, 127);
+      break;
+  }
+
+  for (int i = 0; i < batches * accum_depth; ++i) {
+    input[i] = static_cast<int8_t>(Uniform(rng, -128, 127));
+  }
+  /*Symmetric weights, -128 is not produced by the converter*/
+  for (int i = 0; i < output_depth * accum_depth; ++i) {
+    filter[i] = static_cast<int8_t>(Uniform(rng, -127, 127));
+  }
+  for (int i = 0; i < output_depth; ++i) {
+    bias[i] = Uniform(rng, -20000, 20000);
+  }
+
+  const int input_dims[2] = {batches, accum_depth};
+  const int filter_dims[2] = {output_depth, accum_depth};
+  const int bias_dims[1] = {output_depth};
+  const int output_dims[2] = {batches, output_depth};
+  tflite::reference_integer_ops::FullyConnected(
+      params, tflite::RuntimeShape(2, input_dims), input,
+      tflite::RuntimeShape(2, filter_dims), filter,
+      tflite::RuntimeShape(1, bias_dims), has_bias ? bias : nullptr,
+      tflite::RuntimeShape(2, output_dims), expect);
+
+  tflite::fc_int8_m0::FoldInputOffset(params.input_offset, filter,
+                                      has_bias ? bias : nullptr, output_depth,
+                                      accum_depth, folded_bias);
+  tflite::fc_int8_m0::FullyConnected(params, folded_bias, batches, output_depth,
+                                     accum_depth, input, filter, actual);
+
+  int mismatch = 0;
+  for (int i = 0; i < batches * output_depth; ++i) {
+    mismatch += (actual[i] != expect[i]) ? 1 : 0;
+  }
+  if (mismatch != 0) {
+    printf("  mismatch: batches %d output %d accum %d input offset %ld output offset %ld "
+           "multiplier %ld shift %d act [%ld, %ld]\n",
+           batches, output_depth, accum_depth, (long)params.input_offset,
+           (long)params.output_offset, (long)params.output_multiplier, params.output_shift,
+           (long)params.quantized_activation_min, (long)params.quantized_activation_max);
+  }
+  *outputs += batches * output_depth;
+  return mismatch;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+  const int cases = argc > 1 ? atoi(argv[1]) : 2000;
+  const unsigned seed = argc > 2 ? static_cast<unsigned>(strtoul(argv[2], nullptr, 0)) : 1U;
+  std::mt19937 rng(seed);
+  int failures = 0;
+
+  printf("FullyConnected int8 M0 vs reference, %d cases, seed %u\n", cases, seed);
+  printf("  %12s %8s %10s %10s\n", "accum % 4", "cases", "outputs", "mismatch");
+  for (int rem = 0; rem < 4; ++rem) {
+    int outputs = 0;
+    int mismatch = 0;
+    int n = 0;
+
+    /*Accum depths with this remainder, 1 to 3 only run the tail loop*/
+    for (int c = rem; c < cases; c += 4, ++n) {
+      const int accum_depth = rem + 4 * Uniform(rng, rem == 0 ? 1 : 0, (FC_CHECK_MAX_ACCUM - rem) / 4);
+      mismatch += CheckCase(rng, accum_depth, &outputs);
+    }
+    printf("  %12d %8d %10d %10d\n", rem, n, outputs, mismatch);
+    failures += mismatch;
+  }
+  printf("%s\n", failures == 0 ? "FullyConnected bit exact with reference kernel"
+                               : "FullyConnected differs from reference kernel");
+  return failures == 0 ? 0 : 1;
+}
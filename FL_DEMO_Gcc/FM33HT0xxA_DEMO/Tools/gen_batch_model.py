@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""
+Host tool: derive a batch-N variant of a model by rewriting the leading
+dimension of its activation tensors from 1 to N, and emit it as a flash
+resident C array. Run with `make batch_model`.
+
+Usage: gen_batch_model.py <model.tflite|model_data.cpp> <output.cpp> <array name> <N>
+
+Only tensors of subgraph 0 without constant data and with shape [1, ...] are
+changed, weights and biases are shared with the original model. The shape
+vectors are patched in place so the flatbuffer layout stays untouched.
+"""
+import argparse
+import os
+import struct
+import sys
+
+from gen_op_resolver import FlatBuffer, load_model
+
+
+def patch_batch(data, batch):
+    """Return (patched model bytes, names of patched tensors)."""
+    out = bytearray(data)
+    fb = FlatBuffer(data)
+    model = fb.deref(0)
+    buffers = fb.tables(fb.field(model, 4))
+    subgraph = fb.tables(fb.field(model, 2))[0]
+    patched = []
+    for tensor in fb.tables(fb.field(subgraph, 0)):
+        shape = fb.field(tensor, 0)
+        buffer = fb.field(tensor, 2)
+        if shape is None:
+            continue
+        start, rank = fb.vector(shape)
+        data_field = fb.field(buffers[fb.u32(buffer)], 0) if buffer else None
+        constant = data_field is not None and fb.vector(data_field)[1] > 0
+        if constant or rank < 2 or fb.i32(start) != 1:
+            continue
+        struct.pack_into('<i', out, start, batch)
+        name = fb.field(tensor, 3)
+        if name is not None:
+            nstart, num = fb.vector(name)
+            patched.append(data[nstart:nstart + num].decode())
+        else:
+            patched.append('?')
+    return bytes(out), patched
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('model')
+    parser.add_argument('output')
+    parser.add_argument('name')
+    parser.add_argument('batch', type=int)
+    args = parser.parse_args()
+
+    if args.batch < 2:
+        sys.exit('Batch size must be at least 2')
+    data, patched = patch_batch(load_model(args.model), args.batch)
+    if not patched:
+        sys.exit('No [1, ...] activation tensor found')
+
+    lines = [
+        '/* Generated by Tools/gen_batch_model.py from %s, do not edit */'
+        % os.path.basename(args.model),
+        '/* Batch %d, %d activation tensor(s) patched */' % (args.batch, len(patched)),
+        '#include <cstdint>',
+        '',
+        '#include "hello_world_int8_model_data.h"',
+        '',
+        'extern const unsigned char %s[];' % args.name,
+        'const unsigned char %s[] TFLM_MODEL_DATA_ATTR = {' % args.name,
+    ]
+    for i in range(0, len(data), 12):
+        lines.append('  ' + ', '.join('0x%02x' % b for b in data[i:i + 12]) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines += ['};', '']
+    with open(args.output, 'w') as fp:
+        fp.write('\n'.join(lines))
+
+    print('batch %d, %d tensor(s): %s' % (args.batch, len(patched), ', '.join(patched)))
+
+
+if __name__ == '__main__':
+    main()
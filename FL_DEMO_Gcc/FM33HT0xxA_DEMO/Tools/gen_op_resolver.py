@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""
+Host tool: read a model flatbuffer and emit an exact-size op resolver header
+plus a make fragment listing the TFLM kernels to compile. Run with
+`make op_resolver`.
+
+Usage: gen_op_resolver.py <model.tflite|model_data.cpp> <header> <make fragment>
+                          [--kernel OP=registration[@header]]...
+                          [--resolver OP[,OP]...=class[@header]]...
+
+A model C array source (0x.. bytes) is accepted as well as a .tflite file.
+--kernel replaces the default registration of one builtin op, e.g.
+    --kernel FULLY_CONNECTED=tflite::Register_FULLY_CONNECTED_INT8_M0()@fc_int8_m0.h
+--resolver replaces MicroMutableOpResolver by a derived resolver template when
+the model uses any of the listed ops, for ops whose Add method takes no
+registration, e.g.
+    --resolver LOGISTIC,TANH=tflite::LutActivationOpResolver@lut_int8_m0.h
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+TOOL_DIR = os.path.dirname(os.path.abspath(__file__))
+TFLM_INCLUDE = os.path.join(TOOL_DIR, '..', 'COMPONENT_TFLM', 'include')
+SCHEMA_HEADER = os.path.join(TFLM_INCLUDE, 'tensorflow/lite/schema/schema_generated.h')
+RESOLVER_HEADER = os.path.join(TFLM_INCLUDE, 'tensorflow/lite/micro/micro_mutable_op_resolver.h')
+
+# Ops whose kernel source is not named after the op
+KERNEL_SOURCE = {
+    'RELU': 'activations',
+    'RELU6': 'activations',
+    'CONV_2D': 'conv',
+    'DEPTHWISE_CONV_2D': 'depthwise_conv',
+    'AVERAGE_POOL_2D': 'pooling',
+    'MAX_POOL_2D': 'pooling',
+    'RESHAPE': 'reshape',
+    'SQUEEZE': 'squeeze',
+}
+
+
+def load_model(path):
+    """Return model bytes from a .tflite file or a C array source."""
+    if path.endswith('.tflite'):
+        with open(path, 'rb') as fp:
+            return fp.read()
+    with open(path) as fp:
+        src = fp.read()
+    src = re.sub(r'//[^\n]*|/\*.*?\*/', '', src, flags=re.S)
+    body = src[src.index('{') + 1:src.rindex('}')]
+    return bytes(int(x, 16) for x in re.findall(r'0x[0-9a-fA-F]{1,2}\b', body))
+
+
+class FlatBuffer:
+    """Minimal little-endian flatbuffer reader, offsets are absolute."""
+
+    def __init__(self, data):
+        self.data = data
+
+    def u16(self, o):
+        return struct.unpack_from('<H', self.data, o)[0]
+
+    def u32(self, o):
+        return struct.unpack_from('<I', self.data, o)[0]
+
+    def i32(self, o):
+        return struct.unpack_from('<i', self.data, o)[0]
+
+    def deref(self, o):
+        return o + self.u32(o)
+
+    def field(self, table, idx):
+        """Offset of field idx in table, None if absent."""
+        vtable = table - self.i32(table)
+        if 4 + 2 * idx >= self.u16(vtable):
+            return None
+        off = self.u16(vtable + 4 + 2 * idx)
+        return table + off if off else None
+
+    def vector(self, o):
+        """(start, length) of the vector referenced at offset o."""
+        v = self.deref(o)
+        return v + 4, self.u32(v)
+
+    def tables(self, o):
+        """Tables of the table vector referenced at offset o."""
+        start, num = self.vector(o)
+        return [self.deref(start + 4 * i) for i in range(num)]
+
+
+def read_op_codes(data):
+    """Return the (builtin code, custom name) list of model operator_codes."""
+    fb = FlatBuffer(data)
+    model = fb.deref(0)
+    result = []
+    for code in fb.tables(fb.field(model, 1)):
+        deprecated = fb.field(code, 0)
+        custom = fb.field(code, 1)
+        builtin = fb.field(code, 3)
+        # Same as schema_utils GetBuiltinCode(): larger of the two fields
+        value = max(struct.unpack_from('<b', data, deprecated)[0] if deprecated else 0,
+                    fb.i32(builtin) if builtin else 0)
+        name = None
+        if custom is not None:
+            start, num = fb.vector(custom)
+            name = data[start:start + num].decode()
+        result.append((value, name))
+    return result
+
+
+def builtin_names():
+    with open(SCHEMA_HEADER) as fp:
+        src = fp.read()
+    enum = src[src.index('enum BuiltinOperator : int32_t {'):]
+    enum = enum[:enum.index('};')]
+    return {int(v): k for k, v in re.findall(r'BuiltinOperator_(\w+) = (\d+)', enum)}
+
+
+def resolver_method(op):
+    """FULLY_CONNECTED -> AddFullyConnected, CONV_2D -> AddConv2D."""
+    name = 'Add' + ''.join(w.capitalize() if not w[0].isdigit() else w.upper()
+                           for w in op.split('_'))
+    with open(RESOLVER_HEADER) as fp:
+        if re.search(r'\b%s\(' % name, fp.read()) is None:
+            sys.exit('No resolver method %s() for op %s' % (name, op))
+    return name
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('model')
+    parser.add_argument('header')
+    parser.add_argument('makefile')
+    parser.add_argument('--kernel', action='append', default=[])
+    parser.add_argument('--resolver', action='append', default=[])
+    args = parser.parse_args()
+
+    overrides = {}
+    for item in args.kernel:
+        op, reg = item.split('=', 1)
+        reg, _, header = reg.partition('@')
+        overrides[op] = (reg, header)
+
+    names = builtin_names()
+    ops = []
+    for code, custom in read_op_codes(load_model(args.model)):
+        if custom is not None:
+            sys.exit('Custom op %s must be registered by hand' % custom)
+        if names.get(code) is None:
+            sys.exit('Unknown builtin code %d' % code)
+        if names[code] not in ops:
+            ops.append(names[code])
+
+    includes = {h for op, (_, h) in overrides.items() if op in ops and h}
+    resolver = 'tflite::MicroMutableOpResolver'
+    for item in args.resolver:
+        resolver_ops, cls = item.split('=', 1)
+        if any(op in ops for op in resolver_ops.split(',')):
+            resolver, _, header = cls.partition('@')
+            if header:
+                includes.add(header)
+            break
+    includes = sorted(includes)
+    guard = '__%s__' % re.sub(r'\W', '_', os.path.basename(args.header)).upper()
+    lines = [
+        '/* Generated by Tools/gen_op_resolver.py from %s, do not edit */'
+        % os.path.basename(args.model),
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"',
+    ]
+    lines += ['#include "%s"' % h for h in includes]
+    lines += [
+        '',
+        '/* Ops used by the model: %s */' % ', '.join(ops),
+        '#define TFLM_OP_NUM             (%d)' % len(ops),
+        '',
+        'using CapOpResolver = %s<TFLM_OP_NUM>;' % resolver,
+        '',
+        'inline TfLiteStatus CapRegisterOps(CapOpResolver &resolver)',
+        '{',
+    ]
+    for op in ops:
+        reg = overrides.get(op, ('', ''))[0]
+        lines.append('  TF_LITE_ENSURE_STATUS(resolver.%s(%s));' % (resolver_method(op), reg))
+    lines += ['  return kTfLiteOk;', '}', '', '#endif', '']
+    with open(args.header, 'w') as fp:
+        fp.write('\n'.join(lines))
+
+    kernels = []
+    for op in ops:
+        kernel = KERNEL_SOURCE.get(op, op.lower())
+        if kernel not in kernels:
+            kernels.append(kernel)
+    with open(args.makefile, 'w') as fp:
+        fp.write('# Generated by Tools/gen_op_resolver.py from %s, do not edit\n'
+                 % os.path.basename(args.model))
+        fp.write('TFLM_KERNELS := %s\n' % ' '.join(kernels))
+
+    print('%d op(s): %s' % (len(ops), ', '.join(ops)))
+
+
+if __name__ == '__main__':
+    main()
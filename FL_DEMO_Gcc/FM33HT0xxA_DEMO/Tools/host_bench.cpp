@@ -0,0 +1,406 @@
+/* ===========================================  Includes  =========================================== */
+/*
+ * Host tool: benchmark the inference path of CapClassification without a
+ * board. Build and run with `make host_bench`.
+ *
+ * Usage: host_bench [--random N | --sweep | --trace frames.csv] [--repeat R]
+ *                   [--stride S] [--count-per-unit U] [--scores out.csv]
+ *                   [--max-p99-ns T] [--max-arena B]
+ *
+ * The interpreter is built as firmware builds it: same model array, generated
+ * op resolver (Src/tflm_op_resolver.h) and arena size (Src/tflm_arena_size.h),
+ * CapProfiler attached. Inputs are LCG random windows (default 1000), all int8
+ * codes (--sweep) or a recorded TSI trace: one frame of sensor diffCounts per
+ * CSV line, in capFeatureWidgets channel order. Trace frames are quantized and
+ * windowed as CapFeature does, one Invoke() every --stride frames once the
+ * window is full (the activity gate is not modelled).
+ *
+ * Reported: Invoke() latency percentiles, per-op time from CapProfiler, arena
+ * used by the allocator and the bytes touched during the run. --max-p99-ns and
+ * --max-arena turn the report into a gate, exit code 2 when exceeded.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "cap_profiler.h"
+#include "fc_int8_m0.h"
+#include "lut_int8_m0.h"
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+/* ============================================  Define  ============================================ */
+#ifndef MODEL_ARRAY
+#define MODEL_ARRAY g_hello_world_int8_model_data
+#endif
+
+/* Same fallback as hello_world_test.cpp when no arena size is generated */
+#if __has_include("tflm_arena_size.h")
+#include "tflm_arena_size.h"
+#else
+#define TFLM_ARENA_SIZE         (4 * 1024)
+#endif
+
+/* CapFeature defaults, see Src/cap_feature.c */
+#define BENCH_STRIDE            (4)
+#define BENCH_COUNT_PER_UNIT    (100)
+
+/* Invoke() calls between profiler reads, keeps the 32-bit tick sums from wrapping */
+#define BENCH_PROFILE_CHUNK     (256)
+
+/* Arena fill pattern for the touched bytes count */
+#define BENCH_ARENA_PAINT       (0xA5)
+
+#define BENCH_TAG_MAX           (CAP_PROFILER_MAX_TAGS)
+#define BENCH_TAG_LEN           (32)
+
+/* ==========================================  Variables  =========================================== */
+extern const unsigned char MODEL_ARRAY[];
+
+namespace {
+
+alignas(16) uint8_t arena[TFLM_ARENA_SIZE];
+
+/*Firmware resolver when generated, otherwise the one hello_world_test.cpp falls back to*/
+#if __has_include("tflm_op_resolver.h")
+#include "tflm_op_resolver.h"
+TfLiteStatus RegisterOps(CapOpResolver &resolver)
+{
+  return CapRegisterOps(resolver);
+}
+#else
+using CapOpResolver = tflite::LutActivationOpResolver<3>;
+TfLiteStatus RegisterOps(CapOpResolver &resolver)
+{
+  TF_LITE_ENSURE_STATUS(resolver.AddFullyConnected(tflite::Register_FULLY_CONNECTED_INT8_M0()));
+  TF_LITE_ENSURE_STATUS(resolver.AddRelu());
+  TF_LITE_ENSURE_STATUS(resolver.AddLogistic());
+  return kTfLiteOk;
+}
+#endif
+
+struct OpTime {
+  char tag[BENCH_TAG_LEN];
+  uint64_t count;
+  uint64_t ns;
+};
+
+OpTime op_times[BENCH_TAG_MAX];
+int op_num = 0;
+
+/* ====================================  Functions define  ===================================== */
+/*Add the CapProfiler "tag,count,ticks" rows to the 64-bit totals and clear it*/
+void CollectProfile(void)
+{
+  const char *csv = nullptr;
+  CapProfiler_GetCsv(&csv);
+  const char *line = strchr(csv, '\n');     /* skip header */
+  while (line != nullptr && line[1] != '\0') {
+    ++line;
+    char tag[BENCH_TAG_LEN];
+    unsigned long count = 0;
+    unsigned long ticks = 0;
+    if (sscanf(line, "%31[^,],%lu,%lu", tag, &count, &ticks) == 3) {
+      int i = 0;
+      while (i < op_num && strcmp(op_times[i].tag, tag) != 0) {
+        ++i;
+      }
+      if (i == op_num && op_num < BENCH_TAG_MAX) {
+        snprintf(op_times[op_num].tag, BENCH_TAG_LEN, "%s", tag);
+        ++op_num;
+      }
+      if (i < op_num) {
+        op_times[i].count += count;
+        op_times[i].ns += ticks;
+      }
+    }
+    line = strchr(line, '\n');
+  }
+  CapProfiler_Clear();
+}
+
+/*Recorded frames, one row of diffCounts per line. Lines with anything but
+  integers (header, comments) are skipped*/
+bool LoadTrace(const char *path, std::vector<std::vector<int32_t>> *frames)
+{
+  FILE *fp = fopen(path, "r");
+  if (fp == nullptr) {
+    return false;
+  }
+  char line[1024];
+  while (fgets(line, sizeof(line), fp) != nullptr) {
+    std::vector<int32_t> frame;
+    char *p = line;
+    bool valid = true;
+    while (valid && *p != '\0' && *p != '\n' && *p != '\r') {
+      char *end = nullptr;
+      long v = strtol(p, &end, 10);
+      valid = (end != p);
+      frame.push_back(static_cast<int32_t>(v));
+      p = end;
+      while (*p == ' ' || *p == '\t') {
+        ++p;
+      }
+      if (*p == ',') {
+        ++p;
+      }
+    }
+    if (valid && !frame.empty()) {
+      frames->push_back(frame);
+    }
+  }
+  fclose(fp);
+  return !frames->empty();
+}
+
+/*CapFeature_Quantize() with the constants CapFeature derives at start*/
+int8_t QuantizeDiff(int32_t diff, int32_t quant_mult, int32_t diff_limit, int32_t zero_point)
+{
+  if (diff > diff_limit) {
+    diff = diff_limit;
+  } else if (diff < -diff_limit) {
+    diff = -diff_limit;
+  }
+  int32_t q = ((diff * quant_mult + 0x8000) >> 16) + zero_point;
+  q = q > 127 ? 127 : (q < -128 ? -128 : q);
+  return static_cast<int8_t>(q);
+}
+
+/*Windows CapFeature would score from the trace, one per stride once filled*/
+std::vector<std::vector<int8_t>> TraceWindows(const std::vector<std::vector<int32_t>> &frames,
+                                              const TfLiteTensor *input, int stride,
+                                              int count_per_unit)
+{
+  std::vector<std::vector<int8_t>> windows;
+  const size_t size = input->bytes;
+  const size_t frame_len = std::min(frames[0].size(), size);
+  const size_t depth = size / frame_len;
+  const float unit = input->params.scale * static_cast<float>(count_per_unit);
+  const int32_t quant_mult = static_cast<int32_t>(65536.0f / unit + 0.5f);
+  const int32_t diff_limit = static_cast<int32_t>(256.0f * unit) + 1;
+
+  std::vector<int8_t> window(size, static_cast<int8_t>(input->params.zero_point));
+  size_t filled = 0;
+  int stride_cnt = 0;
+  for (const std::vector<int32_t> &frame : frames) {
+    const size_t tail = (depth - 1) * frame_len;
+    std::copy(window.begin() + frame_len, window.begin() + tail + frame_len, window.begin());
+    for (size_t ch = 0; ch < frame_len; ++ch) {
+      const int32_t diff = ch < frame.size() ? frame[ch] : 0;
+      window[tail + ch] = QuantizeDiff(diff, quant_mult, diff_limit, input->params.zero_point);
+    }
+    filled += (filled < depth) ? 1 : 0;
+    ++stride_cnt;
+    if (filled < depth || stride_cnt < stride) {
+      continue;
+    }
+    stride_cnt = 0;
+    windows.push_back(window);
+  }
+  return windows;
+}
+
+uint32_t Percentile(const std::vector<uint32_t> &sorted, int pct)
+{
+  size_t idx = (sorted.size() * pct + 99) / 100;
+  return sorted[idx > 0 ? idx - 1 : 0];
+}
+
+/*Longest run of untouched pattern bytes, the rest was written by TFLM*/
+size_t UntouchedBytes(void)
+{
+  size_t best = 0;
+  size_t run = 0;
+  for (size_t i = 0; i < sizeof(arena); ++i) {
+    run = (arena[i] == BENCH_ARENA_PAINT) ? run + 1 : 0;
+    best = std::max(best, run);
+  }
+  return best;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+  long random_num = 1000;
+  bool sweep = false;
+  const char *trace_path = nullptr;
+  const char *scores_path = nullptr;
+  long repeat = 1;
+  int stride = BENCH_STRIDE;
+  int count_per_unit = BENCH_COUNT_PER_UNIT;
+  unsigned long max_p99 = 0;
+  unsigned long max_arena = 0;
+
+  for (int i = 1; i < argc; ++i) {
+    const bool has_value = (i + 1 < argc);
+    if (strcmp(argv[i], "--random") == 0 && has_value) {
+      random_num = strtol(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--sweep") == 0) {
+      sweep = true;
+    } else if (strcmp(argv[i], "--trace") == 0 && has_value) {
+      trace_path = argv[++i];
+    } else if (strcmp(argv[i], "--repeat") == 0 && has_value) {
+      repeat = strtol(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--stride") == 0 && has_value) {
+      stride = static_cast<int>(strtol(argv[++i], nullptr, 0));
+    } else if (strcmp(argv[i], "--count-per-unit") == 0 && has_value) {
+      count_per_unit = static_cast<int>(strtol(argv[++i], nullptr, 0));
+    } else if (strcmp(argv[i], "--scores") == 0 && has_value) {
+      scores_path = argv[++i];
+    } else if (strcmp(argv[i], "--max-p99-ns") == 0 && has_value) {
+      max_p99 = strtoul(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--max-arena") == 0 && has_value) {
+      max_arena = strtoul(argv[++i], nullptr, 0);
+    } else {
+      fprintf(stderr, "Unknown argument %s, see Tools/host_bench.cpp\n", argv[i]);
+      return 1;
+    }
+  }
+  if (repeat < 1 || stride < 1 || count_per_unit < 1) {
+    fprintf(stderr, "--repeat, --stride and --count-per-unit must be positive\n");
+    return 1;
+  }
+
+  const tflite::Model *model = tflite::GetModel(MODEL_ARRAY);
+  if (model->version() != TFLITE_SCHEMA_VERSION) {
+    fprintf(stderr, "Unsupported schema version %u\n", model->version());
+    return 1;
+  }
+  static CapOpResolver resolver;
+  if (RegisterOps(resolver) != kTfLiteOk) {
+    return 1;
+  }
+  if (CapProfiler_Init() != 0) {
+    return 1;
+  }
+
+  memset(arena, BENCH_ARENA_PAINT, sizeof(arena));
+  tflite::MicroInterpreter interpreter(model, resolver, arena, sizeof(arena), nullptr,
+                                       CapProfiler_Get());
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    fprintf(stderr, "AllocateTensors() failed with a %d byte arena\n", TFLM_ARENA_SIZE);
+    return 1;
+  }
+  TfLiteTensor *input = interpreter.input(0);
+  TfLiteTensor *output = interpreter.output(0);
+  if (input->type != kTfLiteInt8 || output->type != kTfLiteInt8) {
+    fprintf(stderr, "int8 input and output expected\n");
+    return 1;
+  }
+
+  /* Input windows */
+  std::vector<std::vector<int8_t>> windows;
+  if (trace_path != nullptr) {
+    std::vector<std::vector<int32_t>> frames;
+    if (!LoadTrace(trace_path, &frames)) {
+      fprintf(stderr, "No frame read from %s\n", trace_path);
+      return 1;
+    }
+    windows = TraceWindows(frames, input, stride, count_per_unit);
+    printf("Input    : %s, %zu frames of %zu channels -> %zu windows\n", trace_path,
+           frames.size(), frames[0].size(), windows.size());
+  } else if (sweep) {
+    for (int code = -128; code <= 127; ++code) {
+      windows.emplace_back(input->bytes, static_cast<int8_t>(code));
+    }
+    printf("Input    : sweep of all int8 codes, %zu windows\n", windows.size());
+  } else {
+    uint32_t seed = 1U;
+    for (long n = 0; n < random_num; ++n) {
+      std::vector<int8_t> window(input->bytes);
+      for (int8_t &v : window) {
+        seed = seed * 1664525U + 1013904223U;
+        v = static_cast<int8_t>(seed >> 24);
+      }
+      windows.push_back(window);
+    }
+    printf("Input    : %zu LCG random windows\n", windows.size());
+  }
+  if (windows.empty()) {
+    fprintf(stderr, "No window to run\n");
+    return 1;
+  }
+
+  FILE *scores = nullptr;
+  if (scores_path != nullptr && (scores = fopen(scores_path, "w")) == nullptr) {
+    fprintf(stderr, "Cannot write %s\n", scores_path);
+    return 1;
+  }
+
+  /* Timed runs, scores are written for the first pass only */
+  std::vector<uint32_t> latency;
+  latency.reserve(windows.size() * repeat);
+  CapProfiler_Clear();
+  for (long r = 0; r < repeat; ++r) {
+    for (size_t w = 0; w < windows.size(); ++w) {
+      memcpy(input->data.int8, windows[w].data(), input->bytes);
+      const auto begin = std::chrono::steady_clock::now();
+      if (interpreter.Invoke() != kTfLiteOk) {
+        fprintf(stderr, "Invoke() failed on window %zu\n", w);
+        return 1;
+      }
+      const auto end = std::chrono::steady_clock::now();
+      latency.push_back(static_cast<uint32_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+      if (scores != nullptr && r == 0) {
+        for (size_t k = 0; k < output->bytes; ++k) {
+          fprintf(scores, k == 0 ? "%d" : ",%d", output->data.int8[k]);
+        }
+        fputc('\n', scores);
+      }
+      if (latency.size() % BENCH_PROFILE_CHUNK == 0) {
+        CollectProfile();
+      }
+    }
+  }
+  CollectProfile();
+  if (scores != nullptr) {
+    fclose(scores);
+  }
+
+  std::vector<uint32_t> sorted(latency);
+  std::sort(sorted.begin(), sorted.end());
+  uint64_t total = 0;
+  for (uint32_t ns : sorted) {
+    total += ns;
+  }
+  const uint32_t p99 = Percentile(sorted, 99);
+  printf("Invoke() : %zu runs, ns min %u p50 %u p90 %u p99 %u max %u mean %llu\n",
+         sorted.size(), sorted.front(), Percentile(sorted, 50), Percentile(sorted, 90), p99,
+         sorted.back(), static_cast<unsigned long long>(total / sorted.size()));
+
+  printf("%-24s %10s %12s %8s\n", "Op", "Count", "ns/Invoke", "Share");
+  uint64_t op_total = 0;
+  for (int i = 0; i < op_num; ++i) {
+    op_total += op_times[i].ns;
+  }
+  for (int i = 0; i < op_num; ++i) {
+    printf("%-24s %10llu %12llu %7.1f%%\n", op_times[i].tag,
+           static_cast<unsigned long long>(op_times[i].count),
+           static_cast<unsigned long long>(op_times[i].ns / sorted.size()),
+           op_total ? 100.0 * op_times[i].ns / op_total : 0.0);
+  }
+
+  const size_t used = interpreter.arena_used_bytes();
+  const size_t touched = sizeof(arena) - UntouchedBytes();
+  printf("Arena    : %zu of %zu bytes allocated, %zu bytes touched during the run\n", used,
+         sizeof(arena), touched);
+
+  int ret = 0;
+  if (max_p99 != 0 && p99 > max_p99) {
+    printf("FAIL: p99 %u ns above %lu ns\n", p99, max_p99);
+    ret = 2;
+  }
+  if (max_arena != 0 && used > max_arena) {
+    printf("FAIL: arena %zu bytes above %lu bytes\n", used, max_arena);
+    ret = 2;
+  }
+  return ret;
+}
@@ -0,0 +1,117 @@
+/* ===========================================  Includes  =========================================== */
+/*
+ * Host tool: check the LUT Logistic/Tanh tables against the reference int8
+ * kernels (bit exactness) and against float math (error in output LSB) over
+ * every int8 input code. Build and run with `make lut_check`.
+ *
+ * Usage: lut_check
+ * Exit code is non-zero on any mismatch with the reference kernel.
+ */
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+#include "lut_int8_m0.h"
+#include "tensorflow/lite/kernels/internal/cppmath.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/logistic.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/tanh.h"
+
+/* ==========================================  Variables  =========================================== */
+namespace {
+
+struct InputQuant {
+  float scale;
+  int32_t zero_point;
+};
+
+/* Typical pre-activation ranges, [-8, 8] and narrower, symmetric and not */
+const InputQuant kInputQuants[] = {
+  {1.0f / 16, 0},
+  {1.0f / 16, -128},
+  {0.03125f, 0},
+  {0.05f, -20},
+  {0.1f, 0},
+  {0.2f, 10},
+};
+
+/* ====================================  Functions define  ===================================== */
+/*Reference kernel on one input code, params as in the reference Prepare()*/
+int8_t Reference(bool tanh, const InputQuant &q, int8_t x)
+{
+  constexpr int kInputIntegerBits = 4;
+  const double multiplier =
+      static_cast<double>(q.scale) * static_cast<double>(1 << (31 - kInputIntegerBits));
+  int left_shift = 0;
+  const double frac = std::frexp(multiplier, &left_shift);
+  const int32_t input_multiplier = static_cast<int32_t>(tflite::TfLiteRound(frac * (1ll << 31)));
+  const int32_t radius = tflite::CalculateInputRadius(kInputIntegerBits, left_shift, 31);
+  int8_t y = 0;
+
+  if (tanh) {
+    const int32_t dims[1] = {1};
+    const tflite::RuntimeShape shape(1, dims);
+    tflite::reference_integer_ops::Tanh(q.zero_point, radius, input_multiplier, left_shift,
+                                        shape, &x, shape, &y);
+  } else {
+    tflite::reference_integer_ops::Logistic(q.zero_point, radius, input_multiplier,
+                                            left_shift, 1, &x, &y);
+  }
+  return y;
+}
+
+/*Quantized float result, output params fixed by the kernels*/
+double Ideal(bool tanh, const InputQuant &q, int8_t x)
+{
+  const double real = (x - q.zero_point) * static_cast<double>(q.scale);
+  return tanh ? std::tanh(real) * 128.0 : 1.0 / (1.0 + std::exp(-real)) * 256.0 - 128.0;
+}
+
+int Check(bool tanh)
+{
+  int failures = 0;
+
+  printf("%s\n", tanh ? "Tanh (output scale 1/128, zero point 0)"
+                      : "Logistic (output scale 1/256, zero point -128)");
+  printf("  %10s %6s %10s %12s %12s\n", "in scale", "in zp", "mismatch", "max err LSB",
+         "mean err LSB");
+  for (const InputQuant &q : kInputQuants) {
+    int8_t lut[LUT_INT8_SIZE];
+    int mismatch = 0;
+    double max_err = 0.0;
+    double sum_err = 0.0;
+
+    if (tanh) {
+      tflite::lut_int8_m0::BuildTanhLut(q.scale, q.zero_point, lut);
+    } else {
+      tflite::lut_int8_m0::BuildLogisticLut(q.scale, q.zero_point, lut);
+    }
+    for (int i = -128; i <= 127; ++i) {
+      const int8_t x = static_cast<int8_t>(i);
+      int8_t y = 0;
+      tflite::lut_int8_m0::Lookup(lut, 1, &x, &y);
+      mismatch += (y != Reference(tanh, q, x)) ? 1 : 0;
+
+      /*Ideal clamped to int8 range, saturation is not an error*/
+      double ideal = Ideal(tanh, q, x);
+      ideal = ideal > 127.0 ? 127.0 : (ideal < -128.0 ? -128.0 : ideal);
+      const double err = std::fabs(y - ideal);
+      max_err = err > max_err ? err : max_err;
+      sum_err += err;
+    }
+    printf("  %10.5f %6d %10d %12.3f %12.3f\n", q.scale, q.zero_point, mismatch, max_err,
+           sum_err / LUT_INT8_SIZE);
+    failures += mismatch;
+  }
+  return failures;
+}
+
+}  // namespace
+
+int main()
+{
+  int failures = Check(false) + Check(true);
+  printf("%s\n", failures == 0 ? "LUT bit exact with reference kernels"
+                               : "LUT differs from reference kernels");
+  return failures == 0 ? 0 : 1;
+}
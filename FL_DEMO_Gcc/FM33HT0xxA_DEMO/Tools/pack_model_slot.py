@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Host tool: package a model into a flash slot image (Inc/app/model_slot.h) so
+firmware can load it without a rebuild. Run with `make model_slot`.
+
+Usage: pack_model_slot.py <model.tflite|model_data.cpp> <image.bin>
+                          [--arena N | --arena-header tflm_arena_size.h]
+                          [--hex image.hex]
+
+The image is a 64-byte header (magic, length, CRC, schema version, required
+ops, arena size) followed by the flatbuffer padded to a 32-bit word. The CRC
+is CRC-32 poly 0x04C11DB7, init 0xFFFFFFFF, no reflection, no final XOR, fed
+as little-endian 32-bit words, the same as the CRC peripheral in 32-bit mode.
+--hex also writes Intel HEX at the slot address for a flash programmer.
+"""
+import argparse
+import re
+import struct
+import sys
+
+from gen_op_resolver import FlatBuffer, load_model, read_op_codes
+
+SLOT_ADDR = 0xA0000000
+SLOT_SIZE = 6 * 2048
+SLOT_MAGIC = 0x534D4654
+SLOT_VERSION = 1
+SLOT_OP_MAX = 16
+HEADER_SIZE = 64
+CRC_OFFSET = 12     # CRC covers the header from the length field on
+
+
+def crc32_words(data):
+    crc = 0xFFFFFFFF
+    for (word,) in struct.iter_unpack('<I', data):
+        crc ^= word
+        for _ in range(32):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else (crc << 1)
+            crc &= 0xFFFFFFFF
+    return crc
+
+
+def arena_from_header(path):
+    with open(path) as fp:
+        match = re.search(r'#define\s+TFLM_ARENA_SIZE\s+\(?(\d+)', fp.read())
+    if match is None:
+        sys.exit('No TFLM_ARENA_SIZE in %s' % path)
+    return int(match.group(1))
+
+
+def write_hex(path, base, data):
+    lines = []
+    upper = None
+    for off in range(0, len(data), 16):
+        addr = base + off
+        if addr >> 16 != upper:
+            upper = addr >> 16
+            rec = struct.pack('>BHBH', 2, 0, 4, upper)
+            lines.append(':' + rec.hex().upper() + '%02X' % (-sum(rec) & 0xFF))
+        chunk = data[off:off + 16]
+        rec = struct.pack('>BHB', len(chunk), addr & 0xFFFF, 0) + chunk
+        lines.append(':' + rec.hex().upper() + '%02X' % (-sum(rec) & 0xFF))
+    lines.append(':00000001FF')
+    with open(path, 'w') as fp:
+        fp.write('\n'.join(lines) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('model')
+    parser.add_argument('image')
+    group = parser.add_mutually_exclusive_group()
+    group.add_argument('--arena', type=int, default=0)
+    group.add_argument('--arena-header')
+    parser.add_argument('--hex')
+    args = parser.parse_args()
+
+    model = load_model(args.model)
+    fb = FlatBuffer(model)
+    version_field = fb.field(fb.deref(0), 0)
+    schema = fb.u32(version_field) if version_field is not None else 0
+
+    ops = []
+    for code, custom in read_op_codes(model):
+        if custom is not None:
+            sys.exit('Custom op %s cannot be checked by the loader' % custom)
+        if code not in ops:
+            ops.append(code)
+    if len(ops) > SLOT_OP_MAX:
+        sys.exit('%d ops, slot header holds %d' % (len(ops), SLOT_OP_MAX))
+
+    arena = arena_from_header(args.arena_header) if args.arena_header else args.arena
+    payload = model + b'\0' * (-len(model) % 4)
+    if HEADER_SIZE + len(payload) > SLOT_SIZE:
+        sys.exit('Model of %d bytes does not fit the %d byte slot' % (len(model), SLOT_SIZE))
+
+    tail = struct.pack('<IIIHH%dHI' % SLOT_OP_MAX, len(model), schema, arena, len(ops), 0,
+                       *(ops + [0] * (SLOT_OP_MAX - len(ops))), 0)
+    crc = crc32_words(tail + payload)
+    image = struct.pack('<IHHI', SLOT_MAGIC, HEADER_SIZE, SLOT_VERSION, crc) + tail + payload
+    assert len(image) == HEADER_SIZE + len(payload)
+
+    with open(args.image, 'wb') as fp:
+        fp.write(image)
+    if args.hex:
+        write_hex(args.hex, SLOT_ADDR, image)
+
+    print('%d byte model, schema %d, ops %s, arena %d, crc 0x%08X -> %d byte image'
+          % (len(model), schema, ops, arena, crc, len(image)))
+
+
+if __name__ == '__main__':
+    main()
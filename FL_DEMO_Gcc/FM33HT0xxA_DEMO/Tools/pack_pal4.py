@@ -0,0 +1,496 @@
+#!/usr/bin/env python3
+"""
+Host tool: pack the FullyConnected weights of a model to 4-bit palette
+indices (Src/fc_pal4_m0.h), print an accuracy report and emit the packed
+model as a flash resident C array. Run with `make pal4_model`.
+
+Usage: pack_pal4.py <model.tflite|model_data.cpp> <output.cpp> <array name>
+                    [--per-channel] [--samples N] [--tflite packed.tflite]
+
+Constant int8 filters with per-tensor zero point 0 are replaced by a 16-entry
+int8 palette (one per tensor, or one per output channel with --per-channel)
+and a nibble per weight. Palettes are optimal 1-D k-means over the weight
+codes, so filters with at most 16 distinct codes are packed losslessly. The
+tensor type becomes INT4 and the freed bytes are cut from the flatbuffer; the
+other tables are kept as they are and only the offsets crossing a cut are
+rewritten, using the field layout read from schema_generated.h. Cuts are
+multiples of 16 bytes so buffer alignment is kept, filters that would not free
+16 bytes are left as int8.
+
+The report gives the weight error per packed filter and, for models made of
+FullyConnected ops only, the output error of the integer reference over all
+input codes (single input value) or N random inputs.
+"""
+import argparse
+import math
+import os
+import random
+import re
+import struct
+import sys
+
+from gen_op_resolver import SCHEMA_HEADER, FlatBuffer, load_model, read_op_codes
+
+FULLY_CONNECTED = 9
+TENSOR_INT8 = 9
+TENSOR_INT4 = 17
+PAL4_MAGIC = 0x3450     # FC_PAL4_MAGIC
+PALETTE_SIZE = 16
+CUT_ALIGN = 16
+
+# FullyConnectedOptions.fused_activation_function
+ACT_NONE, ACT_RELU, ACT_RELU_N1_TO_1, ACT_RELU6 = 0, 1, 2, 3
+
+
+def read_schema():
+    """{table: {slot: kind}} of the offset fields of every table, kind is
+    ('leaf',) for strings and scalar vectors, ('table', T), ('tables', T),
+    ('offsets',) for vectors of strings, ('union', {type value: T})."""
+    with open(SCHEMA_HEADER) as fp:
+        src = fp.read()
+    unions = {}
+    for name, body in re.findall(r'enum (\w+) : uint8_t \{(.*?)\};', src, re.S):
+        members = re.findall(r'\b%s_(\w+) = (\d+)' % name, body)
+        unions[name] = {int(v): k for k, v in members if k not in ('NONE', 'MIN', 'MAX')}
+    schema = {}
+    for name, body in re.findall(
+            r'struct (\w+) FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table \{(.*?)\n\};',
+            src, re.S):
+        vt = re.search(r'enum FlatBuffersVTableOffset[^{]*\{(.*?)\}', body, re.S)
+        fields = {}
+        for field, off in re.findall(r'VT_(\w+) = (\d+)', vt.group(1)) if vt else []:
+            if not re.search(r'VerifyOffset(Required)?\(verifier, VT_%s\)' % field, body):
+                continue
+            acc = field.lower()
+            ret = re.search(r'\n  const ([^\n]*?) ?\*%s\(\) const \{' % acc, body).group(1)
+            if 'Offset<::flatbuffers::String>' in ret:
+                kind = ('offsets',)
+            elif 'Offset<' in ret:
+                kind = ('tables', re.search(r'Offset<(?:tflite::)?(\w+)>', ret).group(1))
+            elif 'Vector' in ret or 'String' in ret:
+                kind = ('leaf',)
+            elif ret == 'void':
+                union = re.search(r'Verify(\w+)\(verifier, %s\(\), %s_type\(\)\)'
+                                  % (acc, acc), body).group(1)
+                kind = ('union', unions[union], slot_of(vt.group(1), field + '_TYPE'))
+            else:
+                kind = ('table', ret.replace('tflite::', '').strip())
+            fields[(int(off) - 4) // 2] = kind
+        known = [int(off) for _, off in re.findall(r'VT_(\w+) = (\d+)', vt.group(1))] if vt else []
+        schema[name] = (fields, (max(known) - 4) // 2 + 1 if known else 0)
+    return schema
+
+
+def slot_of(vt_body, field):
+    return (int(re.search(r'VT_%s = (\d+)' % field, vt_body).group(1)) - 4) // 2
+
+
+def collect_offsets(data, schema):
+    """(uoffset locations, table positions) of the whole model."""
+    fb = FlatBuffer(data)
+    uoffsets = {0}
+    tables = set()
+
+    def visit(table, name):
+        if table in tables:
+            return
+        tables.add(table)
+        fields, count = schema[name]
+        vtable = table - fb.i32(table)
+        for slot in range(count, (fb.u16(vtable) - 4) // 2):
+            if fb.u16(vtable + 4 + 2 * slot):
+                sys.exit('%s has field %d unknown to schema_generated.h' % (name, slot))
+        for slot, kind in fields.items():
+            loc = fb.field(table, slot)
+            if loc is None:
+                continue
+            uoffsets.add(loc)
+            if kind[0] == 'table':
+                visit(fb.deref(loc), kind[1])
+            elif kind[0] == 'union':
+                type_loc = fb.field(table, kind[2])
+                member = kind[1].get(data[type_loc] if type_loc is not None else 0)
+                if member is None:
+                    sys.exit('%s field %d: unknown union member' % (name, slot))
+                visit(fb.deref(loc), member)
+            elif kind[0] in ('tables', 'offsets'):
+                start, num = fb.vector(loc)
+                for i in range(num):
+                    uoffsets.add(start + 4 * i)
+                    if kind[0] == 'tables':
+                        visit(fb.deref(start + 4 * i), kind[1])
+
+    visit(fb.deref(0), 'Model')
+    return uoffsets, tables
+
+
+def cut(data, schema, cuts):
+    """Remove the (start, length) byte ranges, none of which is referenced,
+    and rewrite the offsets across them."""
+    uoffsets, tables = collect_offsets(data, schema)
+    fb = FlatBuffer(data)
+    cuts = sorted(cuts)
+
+    def moved(pos):
+        return pos - sum(length for start, length in cuts if start + length <= pos)
+
+    out = bytearray()
+    prev = 0
+    for start, length in cuts:
+        out += data[prev:start]
+        prev = start + length
+    out += data[prev:]
+    for loc in uoffsets:
+        struct.pack_into('<I', out, moved(loc), moved(fb.deref(loc)) - moved(loc))
+    for table in tables:
+        struct.pack_into('<i', out, moved(table), moved(table) - moved(table - fb.i32(table)))
+    return bytes(out)
+
+
+def fit_palette(codes):
+    """16 int8 entries minimizing the squared error over codes (1-D k-means,
+    dynamic programming over the code histogram)."""
+    hist = {}
+    for c in codes:
+        hist[c] = hist.get(c, 0) + 1
+    vals = sorted(hist)
+    if len(vals) <= PALETTE_SIZE:
+        return vals + [vals[-1]] * (PALETTE_SIZE - len(vals))
+
+    s0, s1, s2 = [0], [0], [0]
+    for v in vals:
+        s0.append(s0[-1] + hist[v])
+        s1.append(s1[-1] + hist[v] * v)
+        s2.append(s2[-1] + hist[v] * v * v)
+
+    def cost(i, j):     # vals[i:j] in one cluster
+        n = s0[j] - s0[i]
+        return s2[j] - s2[i] - (s1[j] - s1[i]) ** 2 / n
+
+    m = len(vals)
+    prev = [cost(0, j) if j else 0.0 for j in range(m + 1)]
+    splits = []
+    for _ in range(PALETTE_SIZE - 1):
+        cur = [math.inf] * (m + 1)
+        arg = [0] * (m + 1)
+
+        def solve(lo, hi, opt_lo, opt_hi):  # optimal split is monotone in j
+            if lo > hi:
+                return
+            j = (lo + hi) // 2
+            for i in range(opt_lo, min(j, opt_hi) + 1):
+                c = prev[i] + (cost(i, j) if i < j else 0.0)
+                if c < cur[j]:
+                    cur[j], arg[j] = c, i
+            solve(lo, j - 1, opt_lo, arg[j])
+            solve(j + 1, hi, arg[j], opt_hi)
+
+        solve(1, m, 0, m - 1)
+        splits.append(arg)
+        prev = cur
+
+    bounds = [m]
+    for arg in reversed(splits):
+        bounds.append(arg[bounds[-1]])
+    bounds.append(0)
+    bounds.reverse()
+    palette = []
+    for i, j in zip(bounds, bounds[1:]):
+        if j > i:
+            palette.append(max(-128, min(127, round((s1[j] - s1[i]) / (s0[j] - s0[i])))))
+    return palette + [palette[-1]] * (PALETTE_SIZE - len(palette))
+
+
+def nearest(palette, code):
+    return min(range(PALETTE_SIZE), key=lambda k: (abs(palette[k] - code), k))
+
+
+def pack_filter(codes, rows, cols, per_channel):
+    """(packed bytes, decoded codes)."""
+    palettes = [fit_palette(codes[r * cols:(r + 1) * cols]) for r in range(rows)] \
+        if per_channel else [fit_palette(codes)]
+    out = bytearray(struct.pack('<HH', PAL4_MAGIC, len(palettes)))
+    for palette in palettes:
+        out += struct.pack('<16b', *palette)
+    decoded = []
+    for r in range(rows):
+        palette = palettes[r if per_channel else 0]
+        index = [nearest(palette, c) for c in codes[r * cols:(r + 1) * cols]]
+        decoded += [palette[k] for k in index]
+        index += [0] * (cols & 1)
+        out += bytes(index[k] | (index[k + 1] << 4) for k in range(0, len(index), 2))
+    return bytes(out), decoded
+
+
+class Model:
+    """Subgraph 0 tensors and ops, enough for the integer reference."""
+
+    def __init__(self, data):
+        self.data = data
+        fb = self.fb = FlatBuffer(data)
+        model = fb.deref(0)
+        self.buffers = fb.tables(fb.field(model, 4))
+        subgraph = fb.tables(fb.field(model, 2))[0]
+        self.tensors = fb.tables(fb.field(subgraph, 0))
+        self.inputs = self.ints(fb.field(subgraph, 1))
+        self.outputs = self.ints(fb.field(subgraph, 2))
+        codes = read_op_codes(data)
+        self.ops = []
+        for op in fb.tables(fb.field(subgraph, 3)):
+            index = fb.field(op, 0)
+            code = codes[fb.u32(index) if index is not None else 0][0]
+            options = fb.field(op, 4)
+            act = fb.field(fb.deref(options), 0) if options is not None else None
+            self.ops.append((code, self.ints(fb.field(op, 1)), self.ints(fb.field(op, 2)),
+                             struct.unpack_from('<b', data, act)[0] if act is not None else 0))
+
+    def ints(self, loc):
+        if loc is None:
+            return []
+        start, num = self.fb.vector(loc)
+        return [self.fb.i32(start + 4 * i) for i in range(num)]
+
+    def name(self, t):
+        loc = self.fb.field(self.tensors[t], 3)
+        if loc is None:
+            return '?'
+        start, num = self.fb.vector(loc)
+        return self.data[start:start + num].decode()
+
+    def shape(self, t):
+        return self.ints(self.fb.field(self.tensors[t], 0))
+
+    def type_loc(self, t):
+        return self.fb.field(self.tensors[t], 1)
+
+    def type(self, t):
+        loc = self.type_loc(t)
+        return self.data[loc] if loc is not None else 0
+
+    def buffer(self, t):
+        """(start, length) of the constant data, None for activations."""
+        loc = self.fb.field(self.tensors[t], 2)
+        data = self.fb.field(self.buffers[self.fb.u32(loc)], 0) if loc is not None else None
+        if data is None or self.fb.vector(data)[1] == 0:
+            return None
+        return self.fb.vector(data)
+
+    def quant(self, t):
+        """(scales, zero points)."""
+        loc = self.fb.field(self.tensors[t], 4)
+        if loc is None:
+            return [], []
+        q = self.fb.deref(loc)
+        scales, zps = [], []
+        if self.fb.field(q, 2) is not None:
+            start, num = self.fb.vector(self.fb.field(q, 2))
+            scales = list(struct.unpack_from('<%df' % num, self.data, start))
+        if self.fb.field(q, 3) is not None:
+            start, num = self.fb.vector(self.fb.field(q, 3))
+            zps = list(struct.unpack_from('<%dq' % num, self.data, start))
+        return scales, zps
+
+    def weights(self, t):
+        """Filter codes, palettized filters decoded."""
+        start, num = self.buffer(t)
+        raw = self.data[start:start + num]
+        if self.type(t) == TENSOR_INT8:
+            return list(struct.unpack('<%db' % num, raw))
+        rows, cols = self.shape(t)
+        magic, palettes = struct.unpack_from('<HH', raw)
+        assert magic == PAL4_MAGIC
+        row_bytes = (cols + 1) // 2
+        base = 4 + PALETTE_SIZE * palettes
+        codes = []
+        for r in range(rows):
+            palette = struct.unpack_from('<16b', raw, 4 + PALETTE_SIZE * (r if palettes > 1 else 0))
+            for d in range(cols):
+                byte = raw[base + r * row_bytes + d // 2]
+                codes.append(palette[(byte >> 4) if d & 1 else (byte & 0x0F)])
+        return codes
+
+
+def quantize_multiplier(real):
+    if real == 0:
+        return 0, 0
+    frac, shift = math.frexp(real)
+    q = int(math.floor(abs(frac) * (1 << 31) + 0.5)) * (1 if frac > 0 else -1)
+    if q == 1 << 31:
+        q //= 2
+        shift += 1
+    if shift < -31:
+        return 0, 0
+    return q, shift
+
+
+def multiply_by_quantized_multiplier(x, q, shift):
+    """Same as tflite::MultiplyByQuantizedMultiplier (double rounding)."""
+    x = ((x << max(shift, 0)) + (1 << 31)) % (1 << 32) - (1 << 31)
+    if x == q == -(1 << 31):
+        high = (1 << 31) - 1
+    else:
+        ab = x * q
+        ab += (1 << 30) if ab >= 0 else 1 - (1 << 30)
+        high = (abs(ab) >> 31) * (1 if ab >= 0 else -1)   # C division truncates
+    exponent = max(-shift, 0)
+    mask = (1 << exponent) - 1
+    threshold = (mask >> 1) + (1 if high < 0 else 0)
+    return (high >> exponent) + (1 if (high & mask) > threshold else 0)
+
+
+def f32(x):
+    return struct.unpack('<f', struct.pack('<f', x))[0]
+
+
+def run_reference(model, inputs):
+    """Integer FullyConnected reference (reference_integer_ops), returns the
+    int8 codes of the model outputs."""
+    values = dict(zip(model.inputs, inputs))
+    for code, ins, outs, act in model.ops:
+        x = values[ins[0]]
+        filt = model.weights(ins[1])
+        bias_t = ins[2] if len(ins) > 2 else -1
+        bias = [0] * model.shape(ins[1])[0]
+        if bias_t >= 0 and model.buffer(bias_t) is not None:
+            start, num = model.buffer(bias_t)
+            bias = list(struct.unpack_from('<%di' % (num // 4), model.data, start))
+        rows, cols = model.shape(ins[1])
+        (in_s,), (in_zp,) = model.quant(ins[0])
+        (w_s,), _ = model.quant(ins[1])
+        (out_s,), (out_zp,) = model.quant(outs[0])
+        q, shift = quantize_multiplier(f32(in_s * w_s) / out_s)
+        lo, hi = -128, 127
+        if act in (ACT_RELU, ACT_RELU6):
+            lo = max(lo, out_zp)
+        if act == ACT_RELU6:
+            hi = min(hi, out_zp + round(f32(6.0 / out_s)))
+        if act == ACT_RELU_N1_TO_1:
+            lo = max(lo, out_zp + round(f32(-1.0 / out_s)))
+            hi = min(hi, out_zp + round(f32(1.0 / out_s)))
+        y = []
+        for b in range(len(x) // cols):
+            row_in = x[b * cols:(b + 1) * cols]
+            for o in range(rows):
+                acc = bias[o] + sum((v - in_zp) * w
+                                    for v, w in zip(row_in, filt[o * cols:(o + 1) * cols]))
+                acc = multiply_by_quantized_multiplier(acc, q, shift) + out_zp
+                y.append(min(hi, max(lo, acc)))
+        values[outs[0]] = y
+    return [values[t] for t in model.outputs]
+
+
+def accuracy_report(original, packed, samples):
+    if any(code != FULLY_CONNECTED for code, _, _, _ in original.ops):
+        print('output check skipped: model is not FullyConnected only')
+        return
+    if len(original.inputs) != 1 or original.type(original.inputs[0]) != TENSOR_INT8:
+        print('output check skipped: one int8 input expected')
+        return
+    size = 1
+    for d in original.shape(original.inputs[0]):
+        size *= d
+    if size == 1:
+        cases = [[c] for c in range(-128, 128)]
+    else:
+        rnd = random.Random(1)
+        cases = [[rnd.randint(-128, 127) for _ in range(size)] for _ in range(samples)]
+
+    for k, t in enumerate(original.outputs):
+        (scale,), _ = original.quant(t)
+        equal = total = 0
+        max_diff = sum_diff = 0
+        for case in cases:
+            ref = run_reference(original, [case])[k]
+            got = run_reference(packed, [case])[k]
+            for a, b in zip(ref, got):
+                total += 1
+                equal += a == b
+                max_diff = max(max_diff, abs(a - b))
+                sum_diff += abs(a - b)
+        print('output %s over %d input(s): %.1f%% equal, max |diff| %d code(s) (%.4g), '
+              'mean |diff| %.3f code(s)'
+              % (original.name(t), len(cases), 100.0 * equal / total, max_diff,
+                 max_diff * scale, sum_diff / total))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('model')
+    parser.add_argument('output')
+    parser.add_argument('name')
+    parser.add_argument('--per-channel', action='store_true')
+    parser.add_argument('--samples', type=int, default=256)
+    parser.add_argument('--tflite')
+    args = parser.parse_args()
+
+    data = load_model(args.model)
+    model = Model(data)
+    users = {}
+    for code, ins, _, _ in model.ops:
+        for i, t in enumerate(ins):
+            users.setdefault(t, []).append((code, i))
+
+    work = bytearray(data)
+    cuts = []
+    packed_names = []
+    for t, use in sorted(users.items()):
+        if t < 0 or any(u != (FULLY_CONNECTED, 1) for u in use):
+            continue
+        loc = model.buffer(t)
+        scales, zps = model.quant(t)
+        if model.type(t) != TENSOR_INT8 or loc is None or len(model.shape(t)) != 2 \
+                or len(scales) != 1 or any(zps):
+            continue
+        start, num = loc
+        rows, cols = model.shape(t)
+        codes = model.weights(t)
+        blob, decoded = pack_filter(codes, rows, cols, args.per_channel)
+        freed = max(0, (num - len(blob)) // CUT_ALIGN * CUT_ALIGN)
+        diff = [a - b for a, b in zip(codes, decoded)]
+        rms = math.sqrt(sum(c * c for c in codes) / len(codes)) or 1.0
+        err = math.sqrt(sum(d * d for d in diff) / len(diff))
+        print('%s [%d, %d]: %d distinct codes, max |err| %d, rms err %.3f code(s) '
+              '(%.2f%% of weight rms), %d -> %d bytes%s'
+              % (model.name(t), rows, cols, len(set(codes)), max(abs(d) for d in diff),
+                 err, 100.0 * err / rms, num, len(blob),
+                 '' if freed else ', kept as int8 (frees < %d bytes)' % CUT_ALIGN))
+        if not freed:
+            continue
+        work[start:start + len(blob)] = blob
+        work[start + len(blob):start + num] = bytes(num - len(blob))
+        struct.pack_into('<I', work, start - 4, len(blob))
+        work[model.type_loc(t)] = TENSOR_INT4
+        cuts.append((start + num - freed, freed))
+        packed_names.append(model.name(t))
+
+    if not cuts:
+        sys.exit('No FullyConnected filter worth packing')
+    out = cut(bytes(work), read_schema(), cuts)
+    accuracy_report(model, Model(out), args.samples)
+    print('model %d -> %d bytes, %d filter(s) packed' % (len(data), len(out), len(cuts)))
+
+    lines = [
+        '/* Generated by Tools/pack_pal4.py from %s, do not edit */'
+        % os.path.basename(args.model),
+        '/* %s palettes, run with Register_FULLY_CONNECTED_PAL4_M0(): %s */'
+        % ('Per-channel' if args.per_channel else 'Per-tensor', ', '.join(packed_names)),
+        '#include <cstdint>',
+        '',
+        '#include "hello_world_int8_model_data.h"',
+        '',
+        'extern const unsigned char %s[];' % args.name,
+        'const unsigned char %s[] TFLM_MODEL_DATA_ATTR = {' % args.name,
+    ]
+    for i in range(0, len(out), 12):
+        lines.append('  ' + ', '.join('0x%02x' % b for b in out[i:i + 12]) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines += ['};', '']
+    with open(args.output, 'w') as fp:
+        fp.write('\n'.join(lines))
+    if args.tflite:
+        with open(args.tflite, 'wb') as fp:
+            fp.write(out)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""
+Host tool: decode the binary telemetry stream of Src/telemetry.c (frame
+layout in Src/telemetry_frame.h) into one CSV row per frame. Run on a capture
+file, or on a serial port with pyserial installed. `make telemetry_check`
+runs it on the output of Tools/telemetry_loopback.cpp.
+
+Usage: telemetry_decode.py <stream.bin | --port DEV [--baud B]>
+                           [--csv out.csv] [--expect expect.csv]
+
+Rows are seq,key,dropped, then raw,baseline,diff,status per sensor. Frames
+failing the CRC are skipped by hunting for the next sync; a seq gap breaks
+the delta chain, frames are then skipped up to the next keyframe
+(Tools/tuning_client.py requests one at once). Tuning
+responses (Src/tuning.h) on the same stream are skipped by the sync hunt,
+Tools/tuning_client.py reads both. --expect
+compares the decoded rows against the loopback's queued frames, exit code is
+non-zero on any mismatch.
+"""
+import argparse
+import csv
+import sys
+
+SYNC = b'\xA5\x5A'
+FLAG_KEY = 0x01
+HEADER_SIZE = 7
+CRC_SIZE = 2
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def read_varint(payload, pos):
+    code = 0
+    shift = 0
+    while True:
+        if pos >= len(payload) or shift > 28:
+            raise ValueError('truncated varint')
+        byte = payload[pos]
+        pos += 1
+        code |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            break
+    return (code >> 1) ^ -(code & 1), pos
+
+
+def to_int32(value):
+    value &= 0xFFFFFFFF
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+class Decoder:
+    """Frames from a byte stream, fed in any chunk size"""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.ref = None             # [raw, baseline, diff] per sensor of the last frame
+        self.seq = None
+        self.stats = dict(frames=0, crc_errors=0, seq_gaps=0, no_key=0,
+                          target_dropped=0, bytes=0)
+
+    def feed(self, data):
+        self.buf += data
+        self.stats['bytes'] += len(data)
+        frames = []
+        while True:
+            start = self.buf.find(SYNC)
+            if start < 0:
+                del self.buf[:max(0, len(self.buf) - 1)]
+                return frames
+            del self.buf[:start]
+            if len(self.buf) < HEADER_SIZE:
+                return frames
+            size = HEADER_SIZE + self.buf[2] + CRC_SIZE
+            if len(self.buf) < size:
+                return frames
+            frame = bytes(self.buf[:size])
+            crc = frame[-2] | (frame[-1] << 8)
+            if crc16(frame[2:-2]) != crc:
+                self.stats['crc_errors'] += 1
+                del self.buf[:1]
+                continue
+            del self.buf[:size]
+            row = self.decode(frame)
+            if row is not None:
+                frames.append(row)
+
+    def decode(self, frame):
+        flags, seq, dropped, sensor_num = frame[3], frame[4], frame[5], frame[6]
+        payload = frame[HEADER_SIZE:-CRC_SIZE]
+        key = flags & FLAG_KEY
+        if self.seq is not None and seq != (self.seq + 1) & 0xFF:
+            self.stats['seq_gaps'] += 1
+            self.ref = None
+        self.seq = seq
+        if key:
+            self.ref = [[0, 0, 0] for _ in range(sensor_num)]
+        elif self.ref is None or len(self.ref) != sensor_num:
+            self.stats['no_key'] += 1
+            self.ref = None
+            return None
+
+        bitmap_len = (sensor_num + 7) // 8
+        status = [(payload[i >> 3] >> (i & 7)) & 1 for i in range(sensor_num)]
+        pos = bitmap_len
+        values = []
+        try:
+            for i in range(sensor_num):
+                ref = self.ref[i]
+                d_raw, pos = read_varint(payload, pos)
+                d_bsln, pos = read_varint(payload, pos)
+                d_diff, pos = read_varint(payload, pos)
+                ref[0] = (ref[0] + d_raw) & 0xFFFF
+                ref[1] = (ref[1] + d_bsln) & 0xFFFF
+                ref[2] = to_int32(ref[2] + d_diff)
+                values += [ref[0], ref[1], ref[2], status[i]]
+        except ValueError:
+            self.stats['crc_errors'] += 1
+            self.ref = None
+            return None
+        self.stats['frames'] += 1
+        self.stats['target_dropped'] += dropped
+        return [seq, key, dropped] + values
+
+
+def compare(rows, expect_path, stats):
+    with open(expect_path) as f:
+        expect = [[int(v) for v in line] for line in csv.reader(f) if line]
+    mismatch = 0
+    idx = None
+    prev_seq = None
+    for row in rows:
+        if idx is None:
+            idx = next((i for i, e in enumerate(expect) if e[0] == row[0]), None)
+            if idx is None:
+                mismatch += 1
+                continue
+        else:
+            idx += (row[0] - prev_seq) & 0xFF
+        prev_seq = row[0]
+        if idx >= len(expect) or expect[idx] != row:
+            if mismatch < 5:
+                print(f'Mismatch at frame {idx} seq {row[0]}', file=sys.stderr)
+            mismatch += 1
+    # A clean link shall deliver every queued frame
+    if stats['crc_errors'] == 0 and len(rows) != len(expect):
+        print(f'Decoded {len(rows)} frames, expected {len(expect)}', file=sys.stderr)
+        mismatch += 1
+    return len(expect), mismatch
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('stream', nargs='?', help='captured stream')
+    parser.add_argument('--port', help='serial port, needs pyserial')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--csv', help='write decoded rows here instead of stdout')
+    parser.add_argument('--expect', help='expected rows from telemetry_loopback')
+    args = parser.parse_args()
+    if (args.stream is None) == (args.port is None):
+        parser.error('give a stream file or --port')
+
+    decoder = Decoder()
+    out = open(args.csv, 'w', newline='') if args.csv else None
+    writer = csv.writer(out) if out else (None if args.expect else csv.writer(sys.stdout))
+    rows = []
+
+    def emit(frames):
+        rows.extend(frames)
+        if writer:
+            writer.writerows(frames)
+            if not out:
+                sys.stdout.flush()
+
+    if args.port:
+        import serial
+        with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+            try:
+                while True:
+                    emit(decoder.feed(port.read(256)))
+            except KeyboardInterrupt:
+                pass
+    else:
+        with open(args.stream, 'rb') as f:
+            emit(decoder.feed(f.read()))
+    if out:
+        out.close()
+
+    s = decoder.stats
+    print(f"Telemetry: {s['frames']} frames from {s['bytes']} bytes, "
+          f"{s['crc_errors']} CRC errors, {s['seq_gaps']} seq gaps, "
+          f"{s['no_key']} skipped before a keyframe, {s['target_dropped']} dropped on target",
+          file=sys.stderr)
+    if args.expect:
+        expect_num, mismatch = compare(rows, args.expect, s)
+        print(f'Loopback: {len(rows)}/{expect_num} frames decoded, {mismatch} mismatches',
+              file=sys.stderr)
+        return 1 if mismatch else 0
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
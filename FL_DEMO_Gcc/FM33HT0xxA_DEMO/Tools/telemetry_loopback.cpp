@@ -0,0 +1,212 @@
+/* ===========================================  Includes  =========================================== */
+/*
+ * Host tool: loopback of the telemetry stream (Src/telemetry_frame.c) over a
+ * simulated UART. Synthetic sensor frames go through the firmware encoder and
+ * the same two-buffer queue as Src/telemetry.c; the UART drains baud / 10
+ * bytes per frame period, so a slow link drops frames as on the target. Line
+ * errors flip bytes of the stream. A host on the tuning link requests a
+ * keyframe (TUNING_OP_KEYFRAME) D frame periods after a corrupted frame, as
+ * Tools/tuning_client.py does. Run with `make telemetry_check`, which
+ * decodes the stream with Tools/telemetry_decode.py against the expected CSV.
+ *
+ * Usage: telemetry_loopback <stream.bin> <expect.csv> [--frames N] [--sensors N]
+ *                           [--baud B] [--period-us T] [--key-interval K]
+ *                           [--corrupt P] [--key-request D] [--seed S]
+ *
+ * expect.csv has one row per queued frame: seq,key,dropped, then
+ * raw,baseline,diff,status per sensor.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "telemetry_frame.h"
+
+/* ==========================================  Variables  =========================================== */
+namespace {
+
+constexpr int kNone = -1;
+
+/* ====================================  Functions define  ===================================== */
+/*Touches come and go on each sensor, the baseline tracks the untouched level*/
+void Synthesize(std::mt19937 &rng, int frame, std::vector<TelemetrySampleTypeDef> &samples,
+                std::vector<int32_t> &level)
+{
+  std::normal_distribution<float> noise(0.0f, 3.0f);
+
+  for (size_t i = 0; i < samples.size(); ++i) {
+    const bool touched = ((frame / 50 + static_cast<int>(i)) % 7) == 0;
+    level[i] += (frame % 97 == 0) ? 1 : 0;                     /* slow drift */
+    int32_t raw = level[i] + static_cast<int32_t>(noise(rng)) + (touched ? 400 : 0);
+    raw = raw < 0 ? 0 : (raw > 0xFFFF ? 0xFFFF : raw);
+
+    TelemetrySampleTypeDef &s = samples[i];
+    if (frame == 0 || !touched) {
+      s.baseline = static_cast<uint16_t>(level[i]);
+    }
+    s.rawCount = static_cast<uint16_t>(raw);
+    s.diffCount = static_cast<int32_t>(s.rawCount) - static_cast<int32_t>(s.baseline);
+    s.status = s.diffCount > 200 ? 1U : 0U;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 3) {
+    fprintf(stderr, "Usage: telemetry_loopback <stream.bin> <expect.csv> [options], "
+                    "see Tools/telemetry_loopback.cpp\n");
+    return 1;
+  }
+  const char *stream_path = argv[1];
+  const char *expect_path = argv[2];
+  long frame_num = 2000;
+  int sensor_num = 10;
+  long baud = 115200;
+  long period_us = 5000;
+  int key_interval = 8;
+  double corrupt = 0.0;
+  long key_request = -1;
+  unsigned seed = 1;
+
+  for (int i = 3; i < argc; ++i) {
+    const bool has_value = i + 1 < argc;
+    if (strcmp(argv[i], "--frames") == 0 && has_value) {
+      frame_num = strtol(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--sensors") == 0 && has_value) {
+      sensor_num = static_cast<int>(strtol(argv[++i], nullptr, 0));
+    } else if (strcmp(argv[i], "--baud") == 0 && has_value) {
+      baud = strtol(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--period-us") == 0 && has_value) {
+      period_us = strtol(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--key-interval") == 0 && has_value) {
+      key_interval = static_cast<int>(strtol(argv[++i], nullptr, 0));
+    } else if (strcmp(argv[i], "--corrupt") == 0 && has_value) {
+      corrupt = strtod(argv[++i], nullptr);
+    } else if (strcmp(argv[i], "--key-request") == 0 && has_value) {
+      key_request = strtol(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--seed") == 0 && has_value) {
+      seed = static_cast<unsigned>(strtoul(argv[++i], nullptr, 0));
+    } else {
+      fprintf(stderr, "Unknown argument %s, see Tools/telemetry_loopback.cpp\n", argv[i]);
+      return 1;
+    }
+  }
+
+  TelemetryEncoderTypeDef encoder;
+  if (TelemetryFrame_Init(&encoder, static_cast<uint8_t>(sensor_num),
+                          static_cast<uint8_t>(key_interval)) != 0U) {
+    fprintf(stderr, "--sensors shall be 1..%u\n", static_cast<unsigned>(TELEMETRY_SENSOR_MAX));
+    return 1;
+  }
+  FILE *stream = fopen(stream_path, "wb");
+  FILE *expect = fopen(expect_path, "w");
+  if (stream == nullptr || expect == nullptr) {
+    fprintf(stderr, "Cannot open %s or %s\n", stream_path, expect_path);
+    return 1;
+  }
+
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::vector<TelemetrySampleTypeDef> samples(sensor_num);
+  std::vector<int32_t> level(sensor_num);
+  for (int i = 0; i < sensor_num; ++i) {
+    level[i] = 1500 + 100 * i;
+  }
+
+  /* Same queue as Src/telemetry.c: one buffer on the DMA, one pending */
+  std::vector<uint8_t> buf[2];
+  buf[0].resize(TELEMETRY_FRAME_SIZE(TELEMETRY_SENSOR_MAX));
+  buf[1].resize(TELEMETRY_FRAME_SIZE(TELEMETRY_SENSOR_MAX));
+  uint16_t len[2] = {0, 0};
+  int active = kNone;
+  int pending = kNone;
+  size_t active_pos = 0;
+  uint8_t dropped_run = 0;
+  long request_frame = kNone;   /* Frame the host keyframe request arrives */
+  long sent = 0, dropped = 0, corrupted = 0, bytes = 0, requests = 0;
+  /* UART budget in bytes per frame, 8N1 is 10 bits a byte */
+  const double bytes_per_period = static_cast<double>(baud) / 10.0 * period_us / 1e6;
+  double budget = 0.0;
+
+  for (long frame = 0; frame < frame_num; ++frame) {
+    /* UART drains during the frame period, DMA restarts on the pending buffer */
+    budget += bytes_per_period;
+    while (active != kNone && budget >= 1.0) {
+      uint8_t byte = buf[active][active_pos++];
+      if (corrupt > 0.0 && uniform(rng) < corrupt) {
+        byte ^= static_cast<uint8_t>(1U << (rng() & 7U));
+        corrupted++;
+        if (key_request >= 0 && request_frame == kNone) {
+          request_frame = frame + key_request;
+        }
+      }
+      fputc(byte, stream);
+      budget -= 1.0;
+      if (active_pos == len[active]) {
+        active = pending;
+        pending = kNone;
+        active_pos = 0;
+      }
+    }
+    if (active == kNone) {
+      budget = 0.0;   /* an idle line does not bank time */
+    }
+
+    Synthesize(rng, static_cast<int>(frame), samples, level);
+    if (request_frame != kNone && frame >= request_frame) {
+      TelemetryFrame_ForceKey(&encoder);
+      request_frame = kNone;
+      requests++;
+    }
+    int idx;
+    if (active == kNone) {
+      idx = 0;
+    } else if (pending == kNone) {
+      idx = active ^ 1;
+    } else {
+      dropped++;
+      dropped_run = dropped_run < UINT8_MAX ? dropped_run + 1 : dropped_run;
+      continue;
+    }
+
+    len[idx] = TelemetryFrame_Encode(&encoder, samples.data(), dropped_run, buf[idx].data());
+    fprintf(expect, "%u,%u,%u", buf[idx][4], buf[idx][3] & TELEMETRY_FLAG_KEY, dropped_run);
+    for (const TelemetrySampleTypeDef &s : samples) {
+      fprintf(expect, ",%u,%u,%ld,%u", s.rawCount, s.baseline, static_cast<long>(s.diffCount),
+              s.status & 0x01U);
+    }
+    fputc('\n', expect);
+    dropped_run = 0;
+    sent++;
+    bytes += len[idx];
+    if (active == kNone) {
+      active = idx;
+      active_pos = 0;
+    } else {
+      pending = idx;
+    }
+  }
+
+  /* Flush what is queued, as the DMA would */
+  for (int idx : {active, pending}) {
+    if (idx == kNone) {
+      continue;
+    }
+    for (size_t pos = (idx == active) ? active_pos : 0; pos < len[idx]; ++pos) {
+      fputc(buf[idx][pos], stream);
+    }
+  }
+  fclose(stream);
+  fclose(expect);
+
+  printf("Telemetry loopback: %ld frames, %ld sent, %ld dropped, %ld corrupted bytes, "
+         "%ld keyframe requests\n", frame_num, sent, dropped, corrupted, requests);
+  printf("  %.1f bytes/frame, link %.1f bytes/frame period (%ld baud, %ld us)\n",
+         sent != 0 ? static_cast<double>(bytes) / sent : 0.0, bytes_per_period, baud, period_us);
+  return 0;
+}
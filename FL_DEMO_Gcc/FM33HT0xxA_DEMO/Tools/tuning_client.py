@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""
+Host tool: tuning protocol client for Src/tuning.c (frame layout in
+Src/tuning.h). Requests go out on the telemetry UART, responses come back
+interleaved with telemetry frames, which are decoded with
+Tools/telemetry_decode.py and optionally written to --csv. Needs pyserial.
+
+Usage: tuning_client.py --port DEV [--baud B] [--csv out.csv] <command> [args]
+
+  info                              protocol version, sizes, library status
+  tsi-cmd CODE [PARAM0 [PARAM1]]    one TSI_CMD_x or application command
+  read-detconf [FIRST [COUNT]]      detConf thresholds, one line per widget
+  write-detconf FIRST V,V,...       one comma list per widget, as read-detconf
+  read-filter [FIRST [COUNT]]       baseline IIR coefficient, proximity filter
+  write-filter FIRST V,V,V ...
+  read-enable / write-enable MASK   widget enable mask
+  subscribe CHANNELS [DECIMATION]   TELEMETRY_CH_x mask streamed by the target
+  stats                             telemetry and tuning counters
+  keyframe                          next telemetry frame is a keyframe
+  stream [SECONDS]                  only decode telemetry
+
+Values are decimal or 0x hex. A broken telemetry delta chain (lost frame)
+requests a keyframe instead of waiting for the target's keyframe interval.
+"""
+import argparse
+import csv
+import struct
+import sys
+import time
+
+from telemetry_decode import Decoder, crc16
+
+SYNC0 = 0xA5
+SYNC_TELEMETRY = 0x5A
+SYNC_TUNING = 0xC3
+TELEMETRY_HEADER_SIZE = 7
+CRC_SIZE = 2
+OP_RESPONSE = 0x80
+KEY_RETRY = 0.02        # seconds before a lost keyframe request is repeated
+
+OP = dict(info=0x00, tsi_cmd=0x01, read_detconf=0x10, write_detconf=0x11,
+          read_filter=0x12, write_filter=0x13, read_enable=0x14, write_enable=0x15,
+          subscribe=0x20, stats=0x21, keyframe=0x22)
+STATUS = {0: 'ok', 1: 'bad op', 2: 'bad param', 3: 'TSI error', 4: 'library in LPM'}
+LIB_STATUS = {0: 'reset', 1: 'init', 2: 'running', 3: 'suspend'}
+
+# Entry layouts, little-endian, matching the fields listed in Src/tuning.h
+DETCONF_FIELDS = ['activeTh', 'activeHys', 'noiseTh', 'negNoiseTh', 'onDebounce',
+                  'offDebounce', 'bslnNegStopTimeout']
+DETCONF_FORMAT = '<HHHHBBH'
+DETCONF_LTA_FIELDS = ['ltaNegErrTh', 'ltaOnDebounce', 'ltaNegErrorDebounce',
+                      'ltaActiveTimeout', 'ltaNormBslnStopTimeout']
+DETCONF_LTA_FORMAT = 'HBBHH'
+FILTER_FIELDS = ['bslnIIRCoeff', 'filterActiveTh', 'filterDetectTh']
+FILTER_FORMAT = '<BHh'
+STATS_FIELDS = ['frameCnt', 'sentCnt', 'droppedCnt', 'byteCnt', 'channels', 'decimation',
+                'requestCnt', 'crcErrorCnt', 'queueFullCnt', 'rxOverflowCnt']
+STATS_FORMAT = '<IIIIBBIIII'
+
+
+class TuningError(Exception):
+    pass
+
+
+class Link:
+    """Serial link, splits the received bytes into tuning responses and
+    telemetry frames"""
+
+    def __init__(self, port, writer=None):
+        self.port = port
+        self.writer = writer
+        self.buf = bytearray()
+        self.telemetry = Decoder()
+        self.responses = []
+        self.crc_errors = 0
+        self.tag = 0
+        self.key_time = 0.0
+
+    def poll(self):
+        self.buf += self.port.read(max(1, self.port.in_waiting))
+        while True:
+            start = self.buf.find(SYNC0)
+            if start < 0:
+                self.buf.clear()
+                return
+            del self.buf[:start]
+            if len(self.buf) < 3:
+                return
+            if self.buf[1] == SYNC_TELEMETRY:
+                if len(self.buf) < TELEMETRY_HEADER_SIZE:
+                    return
+                size = TELEMETRY_HEADER_SIZE + self.buf[2] + CRC_SIZE
+            elif self.buf[1] == SYNC_TUNING:
+                size = 3 + self.buf[2] + CRC_SIZE
+            else:
+                del self.buf[:1]
+                continue
+            if len(self.buf) < size:
+                return
+            frame = bytes(self.buf[:size])
+            if crc16(frame[2:-2]) != frame[-2] | (frame[-1] << 8):
+                self.crc_errors += 1
+                del self.buf[:1]
+                continue
+            del self.buf[:size]
+            if frame[1] == SYNC_TELEMETRY:
+                rows = self.telemetry.feed(frame)
+                if self.writer:
+                    self.writer.writerows(rows)
+                self.resync()
+            else:
+                self.responses.append(frame)
+
+    def send(self, op, payload=b''):
+        self.tag = (self.tag + 1) & 0xFF
+        body = bytes([self.tag, op]) + bytes(payload)
+        frame = bytes([SYNC0, SYNC_TUNING, len(body)]) + body
+        crc = crc16(frame[2:])
+        self.port.write(frame + bytes([crc & 0xFF, crc >> 8]))
+        return self.tag
+
+    def resync(self):
+        """Without a delta reference every frame up to the next keyframe is
+        skipped, ask for one. The response is not waited for"""
+        now = time.monotonic()
+        if self.telemetry.ref is None and now - self.key_time >= KEY_RETRY:
+            self.key_time = now
+            self.send(OP['keyframe'])
+
+    def request(self, op, payload=b'', timeout=1.0, retries=2):
+        """Send one request, returns the response payload. The target drops a
+        request when its queue is full, so a timeout is retried"""
+        for _ in range(retries + 1):
+            tag = self.send(op, payload)
+            deadline = time.monotonic() + timeout
+            while time.monotonic() < deadline:
+                self.poll()
+                while self.responses:
+                    resp = self.responses.pop(0)
+                    if resp[3] != tag or resp[4] != op | OP_RESPONSE:
+                        continue
+                    status = resp[5]
+                    if status != 0 and status != 3:
+                        raise TuningError(STATUS.get(status, f'status {status}'))
+                    data = resp[6:-CRC_SIZE]
+                    if status == 3:
+                        raise TuningError(f'TSI error, result {data[1]}')
+                    return data
+        raise TuningError('no response')
+
+
+def parse_int(text):
+    return int(text, 0)
+
+
+def entries(link, op, fmt, fields, first, count, size):
+    out = []
+    # Keep each response within the payload limit
+    per_request = max(1, (link.info['payload_max'] - 2) // size)
+    while count > 0:
+        n = min(count, per_request)
+        data = link.request(op, bytes([first, n]))
+        for i in range(n):
+            values = struct.unpack_from(fmt, data, 2 + i * size)
+            out.append((first + i, dict(zip(fields, values))))
+        first += n
+        count -= n
+    return out
+
+
+def write_entries(link, op, fmt, first, lists, size):
+    per_request = max(1, (link.info['payload_max'] - 2) // size)
+    for start in range(0, len(lists), per_request):
+        chunk = lists[start:start + per_request]
+        payload = bytes([first + start, len(chunk)])
+        for values in chunk:
+            payload += struct.pack(fmt, *values)
+        link.request(op, payload)
+
+
+def read_info(link):
+    data = link.request(OP['info'])
+    version, widget_num, sensor_num, detconf_size, filter_size, payload_max, queue_depth, \
+        lib_status = struct.unpack_from('<8B', data)
+    return dict(version=version, widget_num=widget_num, sensor_num=sensor_num,
+                detconf_size=detconf_size, filter_size=filter_size,
+                payload_max=payload_max, queue_depth=queue_depth,
+                lib_status=LIB_STATUS.get(lib_status, lib_status))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('--port', required=True, help='serial port')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--csv', help='write decoded telemetry rows here')
+    parser.add_argument('command')
+    parser.add_argument('args', nargs='*')
+    args = parser.parse_args()
+    cmd = args.command.replace('-', '_')
+    if cmd not in OP and cmd != 'stream':
+        parser.error(f'unknown command {args.command}')
+
+    import serial
+    out = open(args.csv, 'w', newline='') if args.csv else None
+    with serial.Serial(args.port, args.baud, timeout=0.02) as port:
+        link = Link(port, csv.writer(out) if out else None)
+        try:
+            link.info = read_info(link)
+            info = link.info
+            detconf_fmt = DETCONF_FORMAT
+            detconf_fields = DETCONF_FIELDS
+            if info['detconf_size'] > struct.calcsize(DETCONF_FORMAT):
+                detconf_fmt += DETCONF_LTA_FORMAT
+                detconf_fields = DETCONF_FIELDS + DETCONF_LTA_FIELDS
+            a = [parse_int(v) for v in args.args if ',' not in v]
+
+            if cmd == 'info':
+                print(' '.join(f'{k}={v}' for k, v in info.items()))
+            elif cmd == 'tsi_cmd':
+                code, param0, param1 = (a + [0, 0])[:3]
+                data = link.request(OP['tsi_cmd'],
+                                    bytes([code, param0 >> 8, param0 & 0xFF, param1]),
+                                    timeout=3.0)
+                print(f'result={data[1]} exData={data[2:6].hex()}')
+            elif cmd in ('read_detconf', 'read_filter'):
+                first = a[0] if a else 0
+                count = a[1] if len(a) > 1 else info['widget_num'] - first
+                if cmd == 'read_detconf':
+                    rows = entries(link, OP[cmd], detconf_fmt, detconf_fields, first, count,
+                                   info['detconf_size'])
+                else:
+                    rows = entries(link, OP[cmd], FILTER_FORMAT, FILTER_FIELDS, first, count,
+                                   info['filter_size'])
+                for idx, values in rows:
+                    print(f'{idx}: ' + ' '.join(f'{k}={v}' for k, v in values.items()))
+            elif cmd in ('write_detconf', 'write_filter'):
+                first = parse_int(args.args[0])
+                lists = [[parse_int(v) for v in arg.split(',')] for arg in args.args[1:]]
+                if cmd == 'write_detconf':
+                    write_entries(link, OP[cmd], detconf_fmt, first, lists, info['detconf_size'])
+                else:
+                    write_entries(link, OP[cmd], FILTER_FORMAT, first, lists, info['filter_size'])
+                print(f'{len(lists)} widgets written')
+            elif cmd == 'read_enable':
+                print(f"0x{struct.unpack('<I', link.request(OP[cmd]))[0]:08X}")
+            elif cmd == 'write_enable':
+                # Stop, enable commands, start and reconfig run on the target
+                link.request(OP[cmd], struct.pack('<I', a[0]), timeout=5.0)
+            elif cmd == 'subscribe':
+                link.request(OP[cmd], bytes([a[0], a[1] if len(a) > 1 else 1]))
+            elif cmd == 'keyframe':
+                link.request(OP[cmd])
+            elif cmd == 'stats':
+                values = struct.unpack(STATS_FORMAT, link.request(OP[cmd]))
+                print(' '.join(f'{k}={v}' for k, v in zip(STATS_FIELDS, values)))
+
+            if cmd == 'stream' or out:
+                deadline = time.monotonic() + (a[0] if cmd == 'stream' and a else 1e9)
+                try:
+                    while time.monotonic() < deadline:
+                        link.poll()
+                except KeyboardInterrupt:
+                    pass
+        except TuningError as e:
+            print(f'{args.command}: {e}', file=sys.stderr)
+            return 1
+        finally:
+            if out:
+                out.close()
+    s = link.telemetry.stats
+    print(f"Telemetry: {s['frames']} frames, {link.crc_errors} CRC errors", file=sys.stderr)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())